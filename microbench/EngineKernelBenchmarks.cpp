@@ -0,0 +1,281 @@
+#include <benchmark/benchmark.h>
+#include <Aliases.hpp>
+#include <TestUtil.hpp>
+#include <core/BatchedRingBuffer.hpp>
+#include <core/CycleOutputBuffer.hpp>
+#include <core/DAergicModulator.hpp>
+#include <core/EventLoadStats.hpp>
+#include <core/EventProcessor.hpp>
+#include <core/PhaseTimers.hpp>
+#include <core/SynapticTransmissionStats.hpp>
+#include <genesis/PopulationGeneratorFactory.hpp>
+#include <neuro/Population.hpp>
+#include <util/FileUtil.hpp>
+
+using namespace soft_npu;
+
+namespace {
+
+// the engine components a CycleController would own, without its cycle loop, so that kernels can be driven directly
+struct EngineFixture {
+    explicit EngineFixture(std::shared_ptr<ParamsType> params) :
+            params(std::move(params)),
+            dt((*this->params)["cycleController"]["dt"]),
+            population(generatePopulation(*this->params)),
+            eventLoadStats(0),
+            eventProcessor(*this->params, dt, synapticTransmissionStats),
+            dopaminergicModulator(*this->params, *population),
+            staticContext(
+                    eventProcessor,
+                    &dopaminergicModulator,
+                    *population,
+                    cycleOutputBuffer,
+                    synapticTransmissionStats,
+                    phaseTimers,
+                    eventLoadStats) {
+    }
+
+    static std::unique_ptr<Population> generatePopulation(const ParamsType& params) {
+        RandomEngineType randomEngine(params["simulation"]["seed"].get<unsigned int>());
+        return PopulationGeneratorFactory::createFromParams(params, randomEngine)->generatePopulation();
+    }
+
+    CycleContext makeCycleContext(TimeType time) const {
+        return CycleContext(time, staticContext, static_cast<SizeType>(time / dt));
+    }
+
+    std::vector<Synapse*> getExcitatorySynapses() const {
+        std::vector<Synapse*> synapses;
+
+        std::for_each(population->cbeginNeurons(), population->cendNeurons(), [&synapses](const auto& neuron) {
+            if (!neuron->getNeuronParams()->isInhibitory) {
+                synapses.insert(synapses.end(), neuron->cbeginOutboundSynapses(), neuron->cendOutboundSynapses());
+            }
+        });
+
+        return synapses;
+    }
+
+    std::shared_ptr<ParamsType> params;
+    TimeType dt;
+    std::unique_ptr<Population> population;
+    SynapticTransmissionStats synapticTransmissionStats;
+    PhaseTimers phaseTimers;
+    EventLoadStats eventLoadStats;
+    CycleOutputBuffer cycleOutputBuffer;
+    EventProcessor eventProcessor;
+    DAergicModulator dopaminergicModulator;
+    StaticContext staticContext;
+};
+
+std::shared_ptr<ParamsType> getParams(const std::string& populationGeneratorName);
+
+// the p1000 population spelled out neuron by neuron and synapse by synapse
+ParamsType getDetailedParamsOfP1000() {
+    auto population = EngineFixture::generatePopulation(*getParams("p1000"));
+    ParamsType details;
+
+    std::for_each(population->cbeginNeurons(), population->cendNeurons(), [&details](const auto& neuron) {
+        details["neurons"].push_back({
+                {"neuronId", neuron->getNeuronId()},
+                {"neuronParamsName", neuron->getNeuronParams()->isInhibitory ? "inhibitory" : "excitatory"}});
+
+        std::for_each(neuron->cbeginOutboundSynapses(), neuron->cendOutboundSynapses(), [&details](const auto synapse) {
+            details["synapses"].push_back({
+                    {"preSynapticNeuronId", synapse->preSynapticNeuron->getNeuronId()},
+                    {"postSynapticNeuronId", synapse->postSynapticNeuron->getNeuronId()},
+                    {"initialWeight", synapse->weight},
+                    {"conductionDelay", synapse->conductionDelay}});
+        });
+    });
+
+    return details;
+}
+
+std::shared_ptr<ParamsType> getParams(const std::string& populationGeneratorName) {
+    if (populationGeneratorName == "pEvo") {
+        return std::make_shared<ParamsType>(ParamsType::parse(FileUtil::getFileContent(
+                SOFT_NPU_RESOURCES_DIR "/paramsTemplate.json")));
+    }
+
+    auto params = getTemplateParams();
+    (*params)["simulation"]["populationGenerator"] = populationGeneratorName;
+
+    if (populationGeneratorName == "p1000") {
+        (*params)["simulation"]["channelProjector"] = "OneToMany";
+    } else if (populationGeneratorName == "pDetailedParams") {
+        (*params)["populationGenerators"]["pDetailedParams"] = getDetailedParamsOfP1000();
+    }
+
+    return params;
+}
+
+// ring buffer traffic of one slot: emplace the given number of events, then drain them
+void BM_BatchedRingBufferEmplaceDrain(benchmark::State& state) {
+    auto numEventsPerSlot = static_cast<SizeType>(state.range(0));
+    BatchedRingBuffer<std::pair<ValueType, SizeType>> buffer(200, numEventsPerSlot);
+    SizeType offset = 0;
+
+    for (auto _ : state) {
+        for (SizeType i = 0; i < numEventsPerSlot; ++i) {
+            buffer.emplaceAtOffset(1 + (offset++ % 199), 0.1, i);
+        }
+
+        ValueType sum = 0;
+        for (auto it = buffer.cBeginElementsAtCurrentLocation(); it != buffer.cEndElementsAtCurrentLocation(); ++it) {
+            sum += it->first;
+        }
+
+        benchmark::DoNotOptimize(sum);
+        buffer.clearAndAdvance();
+    }
+
+    state.SetItemsProcessed(state.iterations() * numEventsPerSlot);
+}
+BENCHMARK(BM_BatchedRingBufferEmplaceDrain)->RangeMultiplier(8)->Range(8, 4096);
+
+// one transmission over every excitatory synapse of p1000 per iteration; range(0) enables short-term plasticity
+template<bool isPlastic>
+void BM_TransmissionEventProcess(benchmark::State& state) {
+    auto params = getParams("p1000");
+
+    if (state.range(0) != 0) {
+        (*params)["synapseParams"]["shortTermPlasticityParams"] = R"(
+            {"isDepression": true, "restingValue": 0.8, "changeParameter": 0.5, "timeConstant": 100e-3})"_json;
+    }
+
+    EngineFixture fixture(params);
+    std::vector<TransmissionEvent> events;
+
+    for (auto synapse : fixture.getExcitatorySynapses()) {
+        events.emplace_back(synapse->weight, synapse, *synapse->postSynapticNeuron);
+    }
+
+    // sweeps are spaced widely enough that the STDP pairing buffers of the target neurons stay bounded
+    TimeType time = 0;
+    for (auto _ : state) {
+        auto ctx = fixture.makeCycleContext(time);
+
+        for (const auto& event : events) {
+            event.process<isPlastic>(ctx);
+        }
+
+        time += 0.1;
+    }
+
+    state.SetItemsProcessed(state.iterations() * events.size());
+}
+BENCHMARK_TEMPLATE(BM_TransmissionEventProcess, true)->ArgName("stp")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_TransmissionEventProcess, false)->ArgName("stp")->Arg(0)->Arg(1);
+
+// threshold evaluation of a neuron with range(0) continuous inhibition sources; range(1) binds the shared aggregate
+void BM_FireIfAboveThreshold(benchmark::State& state) {
+    auto numSources = static_cast<SizeType>(state.range(0));
+    auto params = getTemplateParams();
+
+    nlohmann::json targetNeuronJson;
+    targetNeuronJson["neuronId"] = 0;
+    targetNeuronJson["neuronParamsName"] = "excitatory";
+    targetNeuronJson["continuousInhibitionSourceNeuronIds"] = nlohmann::json::array();
+
+    auto neuronsJson = nlohmann::json::array();
+    neuronsJson.push_back(targetNeuronJson);
+    for (SizeType i = 1; i <= numSources; ++i) {
+        nlohmann::json sourceNeuronJson;
+        sourceNeuronJson["neuronId"] = i;
+        sourceNeuronJson["neuronParamsName"] = "continuousInhibitionSource";
+        neuronsJson.push_back(sourceNeuronJson);
+        neuronsJson[0]["continuousInhibitionSourceNeuronIds"].push_back(i);
+    }
+
+    auto& populationJson = (*params)["populationGenerators"]["pDetailedParams"];
+    populationJson["neurons"] = neuronsJson;
+    populationJson["synapses"] = nlohmann::json::array();
+    (*params)["simulation"]["populationGenerator"] = "pDetailedParams";
+
+    EngineFixture fixture(params);
+
+    if (state.range(1) != 0) {
+        fixture.population->bindContinuousInhibitions();
+    }
+
+    auto& neuron = fixture.population->getNeuronById(0);
+    TimeType time = 0;
+    SizeType nextSourceId = 1;
+
+    for (auto _ : state) {
+        time += fixture.dt;
+        auto ctx = fixture.makeCycleContext(time);
+
+        // keeps the sources active and the bound aggregate invalidated, as under ongoing inhibitory input
+        fixture.population->getNeuronById(nextSourceId).produceEPSP(ctx, time, 0.01);
+        nextSourceId = nextSourceId == numSources ? 1 : nextSourceId + 1;
+
+        benchmark::DoNotOptimize(neuron.fireIfAboveThreshold<false>(ctx, time));
+    }
+}
+BENCHMARK(BM_FireIfAboveThreshold)->ArgNames({"sources", "bound"})->ArgsProduct({{1, 8, 64}, {0, 1}});
+
+// dopamine release over range(0) live eligibility traces
+void BM_DopamineRelease(benchmark::State& state) {
+    auto numTraces = static_cast<SizeType>(state.range(0));
+    EngineFixture fixture(getParams("p1000"));
+    auto synapses = fixture.getExcitatorySynapses();
+    TimeType releaseTime = 1.0 / (*fixture.params)["dopaminergicModulator"]["releaseFrequency"].get<TimeType>();
+    auto traceCtx = fixture.makeCycleContext(releaseTime - 1e-3);
+    auto releaseCtx = fixture.makeCycleContext(releaseTime);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DAergicModulator modulator(*fixture.params, *fixture.population);
+        for (SizeType i = 0; i < numTraces; ++i) {
+            modulator.createEligibilityTrace(traceCtx, synapses[i % synapses.size()], 0.01);
+        }
+        state.ResumeTiming();
+
+        modulator.processCycle(releaseCtx);
+    }
+
+    state.SetItemsProcessed(state.iterations() * numTraces);
+}
+BENCHMARK(BM_DopamineRelease)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+// a spike on every input channel per iteration; the resulting cycle is processed outside the timed region
+void BM_ProjectChannelSpike(benchmark::State& state, const std::string& populationGeneratorName) {
+    EngineFixture fixture(getParams(populationGeneratorName));
+    auto numChannels = static_cast<SizeType>(state.range(0));
+    TimeType time = 0;
+
+    for (auto _ : state) {
+        auto ctx = fixture.makeCycleContext(time);
+
+        for (SizeType channelId = 0; channelId < numChannels; ++channelId) {
+            fixture.population->projectChannelSpike(ctx, channelId);
+        }
+
+        state.PauseTiming();
+        fixture.eventProcessor.processCycle<false>(ctx);
+        fixture.cycleOutputBuffer.reset();
+        time += fixture.dt;
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * numChannels);
+}
+BENCHMARK_CAPTURE(BM_ProjectChannelSpike, p1000, std::string("p1000"))->ArgName("channels")->Arg(200);
+BENCHMARK_CAPTURE(BM_ProjectChannelSpike, pEvo, std::string("pEvo"))->ArgName("channels")->Arg(2);
+
+void BM_GeneratePopulation(benchmark::State& state, const std::string& populationGeneratorName) {
+    auto params = getParams(populationGeneratorName);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(EngineFixture::generatePopulation(*params));
+    }
+}
+BENCHMARK_CAPTURE(BM_GeneratePopulation, SingleNeuron, std::string("SingleNeuron"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_GeneratePopulation, p1000, std::string("p1000"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_GeneratePopulation, r2dSheet, std::string("r2dSheet"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_GeneratePopulation, pEvo, std::string("pEvo"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_GeneratePopulation, pDetailedParams, std::string("pDetailedParams"))->Unit(benchmark::kMillisecond);
+
+}
@@ -1,6 +1,6 @@
-import sys, pygame
+import os, sys, pygame
 import time
-import pandas as pd
+from soft_npu_columnar import read_table
 pygame.init()
 
 size = width, height = 633, 633
@@ -16,16 +16,18 @@ logging_interval = 100e-3
 
 print('reading simulation data')
 
-df_spike = pd.read_csv('~/git/soft_npu/build/spikeTrains.csv')
-df_spike = df_spike[df_spike['Time'] >= start_time]
-df_locations = pd.read_csv('~/git/soft_npu/build/locations.csv')
-df_neuron_infos = pd.read_csv('~/git/soft_npu/build/neuronInfos.csv')
+result_directory = os.path.expanduser('~/git/soft_npu/build/simulationResult')
+spikes, _ = read_table(os.path.join(result_directory, 'spikes.snpc'))
+neurons, _ = read_table(os.path.join(result_directory, 'neurons.snpc'))
 
-assert len(df_locations) == len(df_neuron_infos)
+spike_mask = spikes['time'] >= start_time
+spike_times = spikes['time'][spike_mask]
+spike_neuron_ids = spikes['neuronId'][spike_mask]
 
-num_neurons = len(df_neuron_infos)
-inhibitory_flags = df_neuron_infos['IsInhibitory'].transform(bool).values.tolist()
-screen_locations = df_locations[['LocationX', 'LocationY']].apply(lambda x: (int(x[0] * width), int((1 - x[1]) * height)), axis=1).values.tolist()
+num_neurons = len(neurons['neuronId'])
+inhibitory_flags = neurons['isInhibitory'].tolist()
+screen_locations = list(zip((neurons['locationX'] * width).astype(int).tolist(),
+                            ((1 - neurons['locationY']) * height).astype(int).tolist()))
 
 screen = pygame.display.set_mode(size)
 
@@ -35,8 +37,7 @@ last_logging_time = 0
 
 print('starting visualization')
 
-for index, row in df_spike.iterrows():
-    spike_t = row['Time']
+for spike_t, spike_neuron_id in zip(spike_times.tolist(), spike_neuron_ids.tolist()):
 
     while t < spike_t:
         for event in pygame.event.get():
@@ -56,4 +57,4 @@ for index, row in df_spike.iterrows():
             last_logging_time = t
         t += dt
         time.sleep(1e-4)
-    neuron_id_to_last_spike_t[int(row['NeuronId'])] = spike_t
+    neuron_id_to_last_spike_t[spike_neuron_id] = spike_t
@@ -1,25 +1,27 @@
 import pandas as pd
 from matplotlib import pyplot as plt
+from soft_npu_columnar import iterate_weight_snapshots, read_table
 
 if __name__ == '__main__':
-    df_syn = pd.read_csv('../build/synapseInfos.csv')
-    df_syn = df_syn[df_syn.IsInhibitory == False]
-    df_spike = pd.read_csv('../build/spikeTrains.csv')
+    df_syn = pd.DataFrame(read_table('../build/simulationResult/synapses.snpc')[0])
+    df_syn = df_syn[df_syn.isInhibitory == False]
+    df_spike = pd.DataFrame(read_table('../build/simulationResult/spikes.snpc')[0])
 
-    # df_weight = pd.read_csv('../build/weightProgression.csv')
-    # df_weight.set_index('Time')
-    # df_weight.plot(figsize=(30, 20), x='Time')
+    # recorded with a weightRecorder params section
+    # _, _, weight_snapshots = iterate_weight_snapshots('../build/weights.snpw')
+    # df_weight = pd.DataFrame({time: weights[:20].copy() for time, weights in weight_snapshots}).T
+    # df_weight.plot(figsize=(30, 20))
 
     target_time = 0.5
     window = 1.0
 
-    df_spike = df_spike[abs(df_spike.Time - target_time) <= window * 0.5]
+    df_spike = df_spike[abs(df_spike.time - target_time) <= window * 0.5]
     # fig, plts = plt.subplots(2)
     # plts[0].scatter(df_spike.Time, df_spike.NeuronId, s=1)
     # plts[1].hist(df_syn.Weight, 100)
     # plt.show()
     plt.figure(figsize=(10, 5))
-    plt.scatter(df_spike.Time, df_spike.NeuronId, s=1, color='black')
+    plt.scatter(df_spike.time, df_spike.neuronId, s=1, color='black')
     plt.xlabel('Time (s)', fontsize=12)
     plt.ylabel('Neuron #', fontsize=12)
     plt.show()
@@ -0,0 +1,137 @@
+import json
+import os
+import struct
+
+import numpy as np
+
+COLUMNAR_MAGIC = b'SNPCOLS1'
+VOLTAGE_PROBE_MAGIC = b'SNPVOLT1'
+
+
+def read_table(path):
+    """Maps the columns of a table written by ColumnarTable (see src/util/ColumnarTable.hpp) without copying.
+
+    Returns a dict of column name to read-only numpy.memmap and the dict of table attributes.
+    """
+    with open(path, 'rb') as f:
+        magic = f.read(8)
+        if magic != COLUMNAR_MAGIC:
+            raise ValueError('{} is not a columnar table'.format(path))
+        header_length, = struct.unpack('=Q', f.read(8))
+        header = json.loads(f.read(header_length))
+
+    columns = {}
+    for column in header['columns']:
+        shape = tuple(column['shape'])
+        if 0 in shape:
+            columns[column['name']] = np.empty(shape, dtype=column['dtype'])
+        else:
+            columns[column['name']] = np.memmap(path, dtype=column['dtype'], mode='r', offset=column['offset'],
+                                                shape=shape)
+    return columns, header['attributes']
+
+
+def read_simulation_result(directory):
+    """Reads all tables written by ColumnarExport::writeSimulationResult, keyed by table name."""
+    tables = {}
+    for file_name in os.listdir(directory):
+        name, extension = os.path.splitext(file_name)
+        if extension == '.snpc':
+            tables[name] = read_table(os.path.join(directory, file_name))
+    return tables
+
+
+def read_voltage_probe(path):
+    """Maps the flush file of a VoltageProbe (see src/core/VoltageProbe.hpp).
+
+    Returns the neuron ids, the sample times and the voltages as a (time x neuron) matrix.
+    """
+    with open(path, 'rb') as f:
+        if f.read(8) != VOLTAGE_PROBE_MAGIC:
+            raise ValueError('{} is not a voltage probe file'.format(path))
+        num_neurons, value_size, _ = struct.unpack('=QII', f.read(16))
+        neuron_ids = np.frombuffer(f.read(8 * num_neurons), dtype='=u8')
+
+    offset = 24 + 8 * num_neurons
+    row_type = np.dtype([('time', '=f8'), ('voltage', '=f{}'.format(value_size), (num_neurons,))])
+    num_rows = (os.path.getsize(path) - offset) // row_type.itemsize
+
+    if num_rows == 0:
+        return neuron_ids, np.empty(0), np.empty((0, num_neurons))
+
+    rows = np.memmap(path, dtype=row_type, mode='r', offset=offset, shape=(num_rows,))
+    return neuron_ids, rows['time'], rows['voltage']
+
+
+WEIGHT_RECORDING_MAGIC = b'SNPWGHT1'
+
+# an unsigned 64-bit LEB128 varint takes at most 10 bytes
+_MAX_VARINT_BYTES = 10
+
+
+def _read_varint(data, position):
+    value = 0
+    shift = 0
+    while True:
+        byte = int(data[position])
+        position += 1
+        value |= (byte & 0x7f) << shift
+        if byte < 0x80:
+            return value, position
+        shift += 7
+
+
+def _read_varints(data, position, count):
+    """Decodes count consecutive varints of the uint8 array data at once, touching only the bytes they span.
+
+    Returns them as a numpy.uint64 array and the position after the last one.
+    """
+    if count == 0:
+        return np.empty(0, dtype=np.uint64), position
+
+    window = np.asarray(data[position:position + count * _MAX_VARINT_BYTES])
+    ends = np.flatnonzero(window < 0x80)[:count]
+    if len(ends) < count:
+        raise ValueError('Truncated weight recording')
+
+    window = window[:ends[-1] + 1]
+    starts = np.concatenate(([0], ends[:-1] + 1))
+    shifts = 7 * (np.arange(len(window)) - np.repeat(starts, ends - starts + 1))
+    groups = (window & 0x7f).astype(np.uint64) << shifts.astype(np.uint64)
+    return np.bitwise_or.reduceat(groups, starts), position + len(window)
+
+
+def iterate_weight_snapshots(path):
+    """Decodes a WeightRecorder file (see src/core/WeightRecorder.hpp).
+
+    Returns the pre- and post-synaptic neuron ids of the recorded synapses and a generator of (time, weights) per
+    snapshot. The file is memory-mapped and each snapshot is decoded as the generator reaches it, so only the current
+    weights are held in memory. The weights array is updated in place from one snapshot to the next, so copy it to keep
+    it.
+    """
+    data = np.memmap(path, dtype=np.uint8, mode='r')
+
+    if bytes(data[:8]) != WEIGHT_RECORDING_MAGIC:
+        raise ValueError('{} is not a weight recording'.format(path))
+
+    value_size, _ = struct.unpack('=II', bytes(data[8:16]))
+    bits_type = np.dtype('=u{}'.format(value_size))
+    num_synapses, position = _read_varint(data, 16)
+
+    id_values, position = _read_varints(data, position, 2 * num_synapses)
+    pre_ids = np.cumsum(id_values[0::2], dtype=np.uint64)
+    post_ids = id_values[1::2].copy()
+
+    def snapshots(position):
+        weight_bits = np.zeros(num_synapses, dtype=bits_type)
+        weights = weight_bits.view('=f{}'.format(value_size))
+        while position < len(data):
+            time, = struct.unpack('=d', bytes(data[position:position + 8]))
+            num_changes, position = _read_varint(data, position + 8)
+            values, position = _read_varints(data, position, 2 * num_changes)
+            # the first index delta is taken from -1
+            indices = np.cumsum(values[0::2].astype(np.int64)) - 1
+            weight_bits[indices] ^= values[1::2].astype(bits_type)
+            yield time, weights
+
+    return pre_ids, post_ids, snapshots(position)
@@ -8,7 +8,12 @@
 namespace soft_npu {
 
 using SizeType = std::size_t;
+#ifdef SOFT_NPU_SINGLE_PRECISION
+using ValueType = float;
+#else
 using ValueType = double;
+#endif
+// time stays double in both builds; it is derived from the integer cycle count each cycle
 using TimeType = double;
 using RandomEngineType = std::default_random_engine;
 using ParamsType = nlohmann::json;
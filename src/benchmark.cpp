@@ -2,7 +2,9 @@
 #include <plog/Appenders/ConsoleAppender.h>
 #include <plog/Init.h>
 #include <plog/Log.h>
+#include <fstream>
 #include <memory>
+#include <util/BenchmarkComparison.hpp>
 #include <util/FileUtil.hpp>
 #include <genesis/SingleNeuronPopulationGenerator.hpp>
 #include "core/StaticInputSimulation.hpp"
@@ -10,27 +12,137 @@
 using namespace plog;
 using namespace soft_npu;
 
-int main()
+void addSample(ParamsType& metrics, const std::string& metricName, bool higherIsBetter, double sample) {
+    auto& metric = metrics[metricName];
+    metric["higherIsBetter"] = higherIsBetter;
+    metric["samples"].push_back(sample);
+}
+
+// per-phase wall times are only recorded when built with SOFT_NPU_PHASE_TIMERS
+double runBenchmark(
+        const std::shared_ptr<const ParamsType>& params,
+        int numRuns,
+        const std::string& metricNameSuffix,
+        ParamsType& metrics) {
+    double aggSynTransmissionProcThroughput = 0;
+
+    for (int i = 0; i < numRuns; ++i) {
+        StaticInputSimulation simulation(params);
+        auto simulationResult = simulation.run();
+        PLOG_INFO << simulationResult;
+        aggSynTransmissionProcThroughput += simulationResult.synapticTransmissionProcessingThroughput;
+
+        addSample(metrics, "synapticTransmissionThroughput" + metricNameSuffix, true,
+                simulationResult.synapticTransmissionProcessingThroughput);
+
+        for (const auto& phaseWallTime : simulationResult.phaseWallTimes) {
+            addSample(metrics, "wallTime." + phaseWallTime.phaseName + metricNameSuffix, false, phaseWallTime.wallTime);
+        }
+    }
+
+    return aggSynTransmissionProcThroughput / numRuns;
+}
+
+// returns the number of regressed metrics, counting baseline metrics that the current result lacks
+int compareToBaseline(const ParamsType& result, const ParamsType& baseline, double regressionThreshold) {
+    int numRegressions = 0;
+
+    for (const auto& comparison : BenchmarkComparison::compare(
+            baseline.at("metrics"), result.at("metrics"), regressionThreshold)) {
+        if (comparison.isMissing) {
+            PLOG_ERROR << "MISSING " << comparison.metricName
+                << ": in the baseline but not measured by this build (phase timers disabled?)";
+            ++ numRegressions;
+            continue;
+        }
+
+        PLOG_INFO << (comparison.isRegression ? "REGRESSION " : "ok ") << comparison.metricName
+            << ": median " << comparison.baselineMedian << " -> " << comparison.currentMedian
+            << " (" << 100 * comparison.relativeRegression << " % worse, noise "
+            << 100 * comparison.relativeNoise << " %)";
+
+        if (comparison.isRegression) {
+            ++ numRegressions;
+        }
+    }
+
+    return numRegressions;
+}
+
+// usage: benchmark [--runs N] [--output result.json] [--compare baseline.json] [--threshold percent]
+int main(int argc, char * argv[])
 {
     ConsoleAppender<plog::TxtFormatter> consoleAppender;
 
     plog::init(plog::debug, &consoleAppender);
 
+    int numRuns = 10;
+    std::string outputPath = "benchmarkResult.json";
+    std::string baselinePath;
+    double regressionThresholdPercent = 5;
+
+    for (int i = 1; i < argc; i += 2) {
+        std::string option = argv[i];
+
+        if (i + 1 == argc) {
+            throw std::runtime_error("Missing value for option: " + option);
+        }
+
+        if (option == "--runs") {
+            numRuns = std::stoi(argv[i + 1]);
+        } else if (option == "--output") {
+            outputPath = argv[i + 1];
+        } else if (option == "--compare") {
+            baselinePath = argv[i + 1];
+        } else if (option == "--threshold") {
+            regressionThresholdPercent = std::stod(argv[i + 1]);
+        } else {
+            throw std::runtime_error("Invalid option: " + option);
+        }
+    }
+
     PLOG_INFO << "Benchmark starting";
 
+    // loaded up front, as the baseline may be the output file of an earlier run
+    ParamsType baseline;
+    if (!baselinePath.empty()) {
+        baseline = ParamsType::parse(FileUtil::getFileContent(baselinePath));
+
+        if (!baseline.is_object() || !baseline.contains("metrics")) {
+            throw std::runtime_error("Baseline has no metrics: " + baselinePath);
+        }
+    }
+
     auto params = std::make_shared<ParamsType>(ParamsType::parse(FileUtil::getFileContent(
             "../resources/benchmarkParams.json")));
 
-    int numRuns = 10;
-    double aggSynTransmissionProcThroughput = 0;
+    auto inferenceParams = std::make_shared<ParamsType>(*params);
+    (*inferenceParams)["simulation"]["inferenceMode"] = true;
 
-    for (int i = 0; i < numRuns; ++i) {
-        StaticInputSimulation simulation(params);
-        auto simulationResult = simulation.run();
-        PLOG_INFO << simulationResult;
-        aggSynTransmissionProcThroughput += simulationResult.synapticTransmissionProcessingThroughput;
+    ParamsType result;
+    result["numRuns"] = numRuns;
+    auto& metrics = result["metrics"];
+
+    auto meanThroughput = runBenchmark(params, numRuns, "", metrics);
+    auto meanInferenceThroughput = runBenchmark(inferenceParams, numRuns, ".inference", metrics);
+
+    PLOG_INFO << "Mean synaptic transmission processing throughput: " << meanThroughput;
+    PLOG_INFO << "Mean synaptic transmission processing throughput (inference mode): " << meanInferenceThroughput
+        << " (" << meanInferenceThroughput / meanThroughput << "x)";
+
+    std::ofstream os(outputPath);
+    os << result.dump(2) << std::endl;
+    PLOG_INFO << "Result written to " << outputPath;
+
+    if (!baselinePath.empty()) {
+        auto numRegressions = compareToBaseline(result, baseline, regressionThresholdPercent / 100);
+
+        if (numRegressions > 0) {
+            PLOG_ERROR << numRegressions << " metric(s) regressed by more than "
+                << regressionThresholdPercent << " % or are missing against " << baselinePath;
+            return 1;
+        }
     }
 
-    PLOG_INFO << "Mean synaptic transmission processing throughput: " << aggSynTransmissionProcThroughput / numRuns;
     PLOG_INFO << "Terminating";
 }
@@ -1,5 +1,7 @@
 #include <genesis/PopulationGeneratorFactory.hpp>
+#include <genesis/TrainedWeightsPopulationGenerator.hpp>
 #include <chrono>
+#include <cmath>
 #include <plog/Log.h>
 #include "AbstractSimulation.hpp"
 #include "CycleController.hpp"
@@ -7,19 +9,70 @@
 #include <core/SimulationResult.hpp>
 #include "Recordings.hpp"
 #include "SynapticTransmissionStats.hpp"
+#include <util/Tracer.hpp>
 
 namespace soft_npu {
 
 AbstractSimulation::AbstractSimulation(std::shared_ptr<const ParamsType> params) :
     randomEngine((*params)["simulation"]["seed"]),
     params(params),
-    populationGenerator(PopulationGeneratorFactory::createFromParams(*params, randomEngine)) {
+    populationGenerator(PopulationGeneratorFactory::createFromParams(*params, randomEngine)),
+    voltageProbeSampleInterval(0) {
+
+    auto it = params->find("voltageProbe");
+    if (it != params->end()) {
+        auto flushFileIt = it->find("flushFile");
+        probeVoltages(
+                (*it)["neuronIds"],
+                (*it)["sampleInterval"],
+                flushFileIt == it->end() ? "" : flushFileIt->get<std::string>());
+    }
 }
 
 void AbstractSimulation::recordVoltage(SizeType neuronId, TimeType time) {
     neuronIdTimePairsToRecordVoltageAt.emplace_back(neuronId, time);
 }
 
+void AbstractSimulation::probeVoltages(
+        std::vector<SizeType> neuronIds,
+        TimeType sampleInterval,
+        std::string flushFilePath) {
+
+    if (sampleInterval <= 0) {
+        throw std::runtime_error("Voltage probe sample interval must be positive");
+    }
+
+    voltageProbeNeuronIds = std::move(neuronIds);
+    voltageProbeSampleInterval = sampleInterval;
+    voltageProbeFlushFilePath = std::move(flushFilePath);
+}
+
+void AbstractSimulation::loadTrainedWeights(std::vector<SynapseInfo> trainedSynapseInfos) {
+    populationGenerator = std::make_unique<TrainedWeightsPopulationGenerator>(
+            std::move(populationGenerator), std::move(trainedSynapseInfos));
+}
+
+// without a flush file, the buffer holds all samples of the run
+static VoltageProbe makeVoltageProbe(
+        const Population& population,
+        const std::vector<SizeType>& neuronIds,
+        TimeType sampleInterval,
+        const std::string& flushFilePath,
+        TimeType dt,
+        TimeType simulationTime) {
+
+    constexpr SizeType flushBufferBytes = 1 << 22;
+
+    auto sampleIntervalNumCycles = std::max(static_cast<SizeType>(1), static_cast<SizeType>(std::round(sampleInterval / dt)));
+    auto rowBytes = sizeof(TimeType) + neuronIds.size() * sizeof(ValueType);
+
+    auto maxNumBufferedRows = flushFilePath.empty() ?
+            static_cast<SizeType>(std::ceil(simulationTime / dt)) / sampleIntervalNumCycles + 1 :
+            std::max(static_cast<SizeType>(1), flushBufferBytes / rowBytes);
+
+    return VoltageProbe(population, neuronIds, sampleIntervalNumCycles, maxNumBufferedRows, flushFilePath);
+}
+
 template<typename T>
 double convertToSecondsTime(const T& val) {
     return std::chrono::duration_cast<std::chrono::microseconds>(val).count() * 1e-6;
@@ -70,15 +123,33 @@ auto extractNeuronInfos(const Population& population) {
     return neuronInfos;
 }
 
+static SizeType getTraceCycleSampleInterval(const ParamsType& params) {
+    auto it = params["simulation"].find("traceCycleSampleInterval");
+    return it == params["simulation"].end() ? 100 : it->get<SizeType>();
+}
+
 SimulationResult AbstractSimulation::run() {
 
     auto startTs = std::chrono::high_resolution_clock::now();
 
     TimeType simulationTime = (*params)["simulation"]["untilTime"];
 
+    // an enclosing trace, such as one of an evolution run, takes precedence
+    auto traceFileIt = (*params)["simulation"].find("traceFile");
+    TraceSession traceSession(
+            traceFileIt != (*params)["simulation"].end() ? traceFileIt->get<std::string>() : "",
+            getTraceCycleSampleInterval(*params));
+
     PLOG_DEBUG << "Generating population";
 
-    std::shared_ptr<Population> population = populationGenerator->generatePopulation();
+    PhasePerfCounts populationGenerationPerfCounts{"population generation", {}};
+    std::shared_ptr<Population> population;
+
+    {
+        ScopedTraceSpan traceSpan("population generation", "simulation");
+        ScopedPerfCounts scopedPerfCounts(populationGenerationPerfCounts.counts);
+        population = populationGenerator->generatePopulation();
+    }
 
     auto startTsEventProcessor = std::chrono::high_resolution_clock::now();
 
@@ -88,20 +159,41 @@ SimulationResult AbstractSimulation::run() {
 
     CycleController controller(
             *params,
-            randomEngine,
             *population,
             true,
             neuronIdTimePairsToRecordVoltageAt,
             *synapticTransmissionStats
     );
 
-    runController(controller, *population, simulationTime, *synapticTransmissionStats);
+    if (isVoltageProbeEnabled()) {
+        controller.setVoltageProbe(makeVoltageProbe(
+                *population,
+                voltageProbeNeuronIds,
+                voltageProbeSampleInterval,
+                voltageProbeFlushFilePath,
+                controller.getTimeIncrement(),
+                simulationTime));
+    }
+
+    {
+        ScopedTraceSpan traceSpan("cycles", "simulation");
+        runController(controller, *population, simulationTime, *synapticTransmissionStats);
+    }
+
     auto endTs = std::chrono::high_resolution_clock::now();
 
     auto wallTimeTotal = convertToSecondsTime(endTs - startTs);
     double wallTimeEventProcessor = convertToSecondsTime(endTs - startTsEventProcessor);
 
     auto recordings = controller.getRecordings();
+    auto voltageSamples = controller.finishVoltageProbe();
+    controller.finishWeightRecording();
+
+    auto phasePerfCounts = controller.getPhaseTimers().getPhasePerfCounts();
+    if (!phasePerfCounts.empty()) {
+        populationGenerationPerfCounts.counts = populationGenerationPerfCounts.counts.getScaled();
+        phasePerfCounts.insert(phasePerfCounts.begin(), populationGenerationPerfCounts);
+    }
 
     auto numInhibitoryNeurons = PopulationUtils::getNumInhibitoryNeurons(*population);
     auto numExcitatoryNeurons = population->getPopulationSize() - numInhibitoryNeurons;
@@ -109,10 +201,11 @@ SimulationResult AbstractSimulation::run() {
     auto meanExcitatoryFiringRate = numExcitatoryNeurons == 0 ? 0 : recordings->numExcitatorySpikes / simulationTime / numExcitatoryNeurons;
     auto meanInhibitoryFiringRate = numInhibitoryNeurons == 0 ? 0 : recordings->numInhibitorySpikes / simulationTime / numInhibitoryNeurons;
 
-    return SimulationResult(
+    SimulationResult simulationResult(
             simulationTime,
             std::move(recordings->neuronSpikeRecordings),
             std::move(recordings->voltageRecordings),
+            std::move(voltageSamples),
             extractNeuronInfos(*population),
             extractSynapseInfos(population),
             extractLocationsIndexedByNeuronId(*population),
@@ -123,7 +216,15 @@ SimulationResult AbstractSimulation::run() {
             meanInhibitoryFiringRate,
             wallTimeTotal,
             wallTimeEventProcessor,
-            controller.getNumEventsProcessed());
+            controller.getNumEventsProcessed(),
+            controller.getPhaseTimers().getPhaseWallTimes(),
+            std::move(phasePerfCounts),
+            controller.getEventLoadStats());
+
+    // after the results are taken, so that writing the trace file counts towards neither wall time
+    traceSession.finish();
+
+    return simulationResult;
 }
 
 }
@@ -3,7 +3,9 @@
 #include <Aliases.hpp>
 #include <genesis/PopulationGenerator.hpp>
 #include <core/SimulationResult.hpp>
+#include <core/SynapseInfo.hpp>
 #include <boost/core/noncopyable.hpp>
+#include <string>
 
 namespace soft_npu {
 
@@ -16,7 +18,16 @@ public:
     AbstractSimulation(std::shared_ptr<const ParamsType> params);
 
     void recordVoltage(SizeType neuronId, TimeType time);
-    SimulationResult run();
+
+    // samples the voltages of the given neurons every sampleInterval, see VoltageProbe; replaces the voltageProbe
+    // params section
+    void probeVoltages(std::vector<SizeType> neuronIds, TimeType sampleInterval, std::string flushFilePath = "");
+
+    // the population is generated as configured, then takes the weights of the given synapses, e.g. the final synapse
+    // infos of a training run with the same params and seed
+    void loadTrainedWeights(std::vector<SynapseInfo> trainedSynapseInfos);
+
+    virtual SimulationResult run();
     virtual void runController(
             CycleController& controller,
             Population& population,
@@ -24,11 +35,18 @@ public:
             SynapticTransmissionStats& synapticTransmissionStats) = 0;
     virtual ~AbstractSimulation() = default;
 protected:
+    bool isVoltageProbeEnabled() const noexcept {
+        return voltageProbeSampleInterval > 0;
+    }
+
     RandomEngineType randomEngine;
     std::shared_ptr<const ParamsType> params;
     std::unique_ptr<PopulationGenerator> populationGenerator;
-private:
     std::vector<std::pair<SizeType, TimeType>> neuronIdTimePairsToRecordVoltageAt;
+private:
+    std::vector<SizeType> voltageProbeNeuronIds;
+    TimeType voltageProbeSampleInterval;
+    std::string voltageProbeFlushFilePath;
 };
 
 }
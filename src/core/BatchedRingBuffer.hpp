@@ -44,6 +44,10 @@ public:
         return buffer[currentPosition].cend();
     }
 
+    SizeType sizeAtCurrentLocation() const noexcept {
+        return buffer[currentPosition].size();
+    }
+
     void clearAndAdvance() noexcept {
 
         buffer[currentPosition].clear();
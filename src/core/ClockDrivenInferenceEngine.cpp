@@ -0,0 +1,336 @@
+#include "ClockDrivenInferenceEngine.hpp"
+#include "EventProcessor.hpp"
+#include "EventLoadStats.hpp"
+#include "PhaseTimers.hpp"
+#include "StaticContext.hpp"
+#include "CycleOutputBuffer.hpp"
+#include "SynapticTransmissionStats.hpp"
+#include <neuro/Population.hpp>
+#include <neuro/Synapse.hpp>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+
+namespace soft_npu {
+
+namespace {
+
+// the same offsets as EventProcessor::getTargetOffset
+SizeType getDelayNumCycles(TimeType delay, TimeType dt) {
+    ValueType frequency = 1 / dt;
+    return std::max(static_cast<SizeType>(1), static_cast<SizeType>(ceil(delay * frequency)));
+}
+
+SizeType getMaxDelayNumCycles(const Population& population, TimeType dt) {
+    SizeType maxDelayNumCycles = 1;
+
+    for (auto neuronIt = population.cbeginNeurons(); neuronIt != population.cendNeurons(); ++neuronIt) {
+        if (*neuronIt == nullptr) {
+            throw std::runtime_error("Clock-driven inference cannot be used with partitions");
+        }
+
+        for (auto synIt = (*neuronIt)->cbeginOutboundSynapses(); synIt != (*neuronIt)->cendOutboundSynapses(); ++synIt) {
+            maxDelayNumCycles = std::max(maxDelayNumCycles, getDelayNumCycles((*synIt)->conductionDelay, dt));
+        }
+    }
+
+    if (maxDelayNumCycles > std::numeric_limits<uint16_t>::max()) {
+        throw std::runtime_error("Conduction delays are too long for clock-driven inference");
+    }
+
+    return maxDelayNumCycles;
+}
+
+}
+
+ClockDrivenInferenceEngine::ClockDrivenInferenceEngine(
+        const Population& population, TimeType dt, ValueType minEventDensity) :
+        minEventDensity(minEventDensity),
+        populationSize(population.getPopulationSize()),
+        transmissionBuffer(getMaxDelayNumCycles(population, dt) + 1, 0),
+        numEventsProcessed(0),
+        numClockDrivenCycles(0),
+        lastClockDrivenTime(noClockDrivenTime) {
+
+    if (!(minEventDensity >= 0)) {
+        throw std::runtime_error("The minimum event density of clock-driven inference must not be negative");
+    }
+
+    if (populationSize > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("Population is too large for clock-driven inference");
+    }
+
+    // neurons sharing their params share a type
+    std::map<const NeuronParams*, uint32_t> neuronTypeIdsByParams;
+
+    for (auto neuronIt = population.cbeginNeurons(); neuronIt != population.cendNeurons(); ++neuronIt) {
+        const auto& neuron = **neuronIt;
+        const auto& neuronParams = *neuron.getNeuronParams();
+
+        auto [typeIt, isNewType] = neuronTypeIdsByParams.emplace(
+                &neuronParams, static_cast<uint32_t>(neuronTypes.size()));
+
+        if (isNewType) {
+            neuronTypes.push_back({
+                neuronParams.thresholdVoltage,
+                neuronParams.resetVoltage,
+                neuronParams.voltageFloor,
+                neuronParams.refractoryPeriod,
+                neuronParams.timeConstantInverse,
+                neuronParams.epspOverrideScaleFactor,
+                static_cast<ValueType>(std::exp(- dt * neuronParams.timeConstantInverse))});
+        }
+
+        neuronTypeIds.push_back(typeIt->second);
+
+        ValueType signum = neuronParams.isInhibitory ? -1 : 1;
+
+        for (auto synIt = neuron.cbeginOutboundSynapses(); synIt != neuron.cendOutboundSynapses(); ++synIt) {
+            const auto& synapse = **synIt;
+
+            if (synapse.synapseParams->shortTermPlasticityParams) {
+                throw std::runtime_error("Clock-driven inference does not support short-term plasticity");
+            }
+
+            postSynapticNeuronIds.push_back(static_cast<uint32_t>(synapse.postSynapticNeuron->getNeuronId()));
+            delayNumCycles.push_back(static_cast<uint16_t>(getDelayNumCycles(synapse.conductionDelay, dt)));
+            weights.push_back(synapse.weight * signum);
+        }
+    }
+
+    voltages.resize(populationSize, 0);
+    lastTimes.resize(populationSize, 0);
+    lastSpikeTimes.resize(populationSize, std::numeric_limits<TimeType>::lowest());
+    isThresholdEvalPending.resize(populationSize, false);
+    inputs.resize(populationSize, 0);
+    hasInput.resize(populationSize, false);
+
+    synapseOffsets.push_back(0);
+    inhibitionSourceOffsets.push_back(0);
+
+    for (auto neuronIt = population.cbeginNeurons(); neuronIt != population.cendNeurons(); ++neuronIt) {
+        const auto& neuron = **neuronIt;
+
+        synapseOffsets.push_back(synapseOffsets.back() + (neuron.cendOutboundSynapses() - neuron.cbeginOutboundSynapses()));
+
+        for (auto sourceIt = neuron.cbeginInhibitionSources(); sourceIt != neuron.cendInhibitionSources(); ++sourceIt) {
+            inhibitionSourceIds.push_back(static_cast<uint32_t>((*sourceIt)->getNeuronId()));
+        }
+
+        inhibitionSourceOffsets.push_back(inhibitionSourceIds.size());
+    }
+}
+
+template<bool isTraced>
+void ClockDrivenInferenceEngine::processCycle(const CycleContext& ctx, EventProcessor& eventProcessor) {
+
+    auto& phaseTimers = ctx.staticContext.phaseTimers;
+    auto& eventLoadStats = ctx.staticContext.eventLoadStats;
+
+    {
+        ScopedPhaseTimer phaseTimer(phaseTimers, CyclePhase::transmissionEvents);
+        ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::transmissionEvents, ctx.cycleId);
+
+        SizeType numTransmissions =
+                transmissionBuffer.sizeAtCurrentLocation() + eventProcessor.getNumTransmissionEventsAtCurrentLocation();
+
+        // decided per cycle, so that sparse cycles keep the exact arithmetic of the double engine
+        if (numTransmissions >= minEventDensity * populationSize) {
+            processClockDriven(ctx, eventProcessor);
+            lastClockDrivenTime = ctx.time;
+            ++ numClockDrivenCycles;
+        } else {
+            processEventDriven(ctx, eventProcessor);
+            lastClockDrivenTime = noClockDrivenTime;
+        }
+
+        eventLoadStats.record(EventQueue::transmissionEventsPerSlot, numTransmissions);
+        numEventsProcessed += numTransmissions;
+    }
+
+    {
+        ScopedPhaseTimer phaseTimer(phaseTimers, CyclePhase::thresholdEvaluation);
+        ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::thresholdEvaluation, ctx.cycleId);
+        eventLoadStats.record(EventQueue::thresholdEvalCandidates, firingThresholdEvalCandidates.size());
+        processFiringThresholdEvalCandidates(ctx);
+    }
+
+    transmissionBuffer.clearAndAdvance();
+    eventProcessor.processCommonEventsAndAdvance<isTraced>(ctx);
+}
+
+template void ClockDrivenInferenceEngine::processCycle<false>(const CycleContext&, EventProcessor&);
+template void ClockDrivenInferenceEngine::processCycle<true>(const CycleContext&, EventProcessor&);
+
+void ClockDrivenInferenceEngine::processEventDriven(const CycleContext& ctx, EventProcessor& eventProcessor) {
+
+    auto time = ctx.time;
+
+    for (auto cit = transmissionBuffer.cBeginElementsAtCurrentLocation(); cit != transmissionBuffer.cEndElementsAtCurrentLocation(); ++cit) {
+        produceEPSP(time, cit->targetNeuronId, cit->epsp);
+    }
+
+    // pushed during this cycle, so they follow the synaptic transmissions as with the double engine
+    eventProcessor.forEachTransmissionEventAtCurrentLocation([this, time](const TransmissionEvent& event) {
+        produceEPSP(time, event.getTargetNeuron().getNeuronId(), event.getUnscaledEpsp());
+    });
+}
+
+void ClockDrivenInferenceEngine::processClockDriven(const CycleContext& ctx, EventProcessor& eventProcessor) {
+
+    for (auto cit = transmissionBuffer.cBeginElementsAtCurrentLocation(); cit != transmissionBuffer.cEndElementsAtCurrentLocation(); ++cit) {
+        inputs[cit->targetNeuronId] += cit->epsp * neuronTypes[neuronTypeIds[cit->targetNeuronId]].epspOverrideScaleFactor;
+        hasInput[cit->targetNeuronId] = true;
+    }
+
+    eventProcessor.forEachTransmissionEventAtCurrentLocation([this](const TransmissionEvent& event) {
+        auto neuronId = event.getTargetNeuron().getNeuronId();
+        inputs[neuronId] += event.getUnscaledEpsp() * neuronTypes[neuronTypeIds[neuronId]].epspOverrideScaleFactor;
+        hasInput[neuronId] = true;
+    });
+
+    auto time = ctx.time;
+
+    // one pass in neuron id order; inputs onto refractory neurons are dropped as with the double engine
+    for (SizeType neuronId = 0; neuronId < populationSize; ++neuronId) {
+        auto lastTime = lastTimes[neuronId];
+
+        if (time < lastTime) {
+            inputs[neuronId] = 0;
+            hasInput[neuronId] = false;
+            continue;
+        }
+
+        const auto& neuronType = neuronTypes[neuronTypeIds[neuronId]];
+
+        auto voltage = lastTime == lastClockDrivenTime && !hasContinuousInhibition(neuronId) ?
+                voltages[neuronId] * neuronType.decayPerCycle :
+                getMembraneVoltage(neuronId, time);
+
+        lastTimes[neuronId] = time;
+
+        if (hasInput[neuronId]) {
+            voltage = std::max(voltage + inputs[neuronId], neuronType.voltageFloor);
+            voltages[neuronId] = voltage;
+            inputs[neuronId] = 0;
+            hasInput[neuronId] = false;
+
+            if (voltage >= neuronType.thresholdVoltage) {
+                pushFiringThresholdEvalCandidate(neuronId);
+            }
+        } else {
+            voltages[neuronId] = voltage;
+        }
+    }
+}
+
+void ClockDrivenInferenceEngine::processFiringThresholdEvalCandidates(const CycleContext& ctx) {
+
+    SizeType numSpikes = 0;
+
+    // in candidate order, as neurons with continuous inhibition depend on sources firing earlier in this stage
+    for (auto neuronId : firingThresholdEvalCandidates) {
+        isThresholdEvalPending[neuronId] = false;
+
+        auto compareVoltage = voltages[neuronId];
+        if (hasContinuousInhibition(neuronId)) {
+            compareVoltage -= getContinuousInhibition(neuronId, ctx.time);
+        }
+
+        if (compareVoltage >= neuronTypes[neuronTypeIds[neuronId]].thresholdVoltage) {
+            fire(ctx, neuronId);
+            ++ numSpikes;
+        }
+    }
+
+    auto numCandidates = firingThresholdEvalCandidates.size();
+    firingThresholdEvalCandidates.clear();
+
+    lastCycleFiringThresholdEvalStats.numCandidates = numCandidates;
+    lastCycleFiringThresholdEvalStats.numSpikes = numSpikes;
+    totalFiringThresholdEvalStats.numCandidates += numCandidates;
+    totalFiringThresholdEvalStats.numSpikes += numSpikes;
+    numEventsProcessed += numCandidates;
+}
+
+void ClockDrivenInferenceEngine::fire(const CycleContext& ctx, SizeType neuronId) {
+
+    const auto& neuronType = neuronTypes[neuronTypeIds[neuronId]];
+
+    voltages[neuronId] = neuronType.resetVoltage;
+    lastTimes[neuronId] = ctx.time + neuronType.refractoryPeriod;
+    lastSpikeTimes[neuronId] = ctx.time;
+
+    auto synapseBegin = synapseOffsets[neuronId];
+    auto synapseEnd = synapseOffsets[neuronId + 1];
+
+    for (auto synapseIndex = synapseBegin; synapseIndex < synapseEnd; ++synapseIndex) {
+        transmissionBuffer.emplaceAtOffset(
+                delayNumCycles[synapseIndex],
+                Transmission{postSynapticNeuronIds[synapseIndex], weights[synapseIndex]});
+    }
+
+    ctx.staticContext.cycleOutputBuffer.addNeuronSpike(neuronId);
+    ctx.staticContext.synapticTransmissionStats.increaseTransmissionCount(synapseEnd - synapseBegin);
+}
+
+void ClockDrivenInferenceEngine::produceEPSP(TimeType time, SizeType neuronId, ValueType epsp) noexcept {
+
+    if (time < lastTimes[neuronId]) {
+        return;
+    }
+
+    const auto& neuronType = neuronTypes[neuronTypeIds[neuronId]];
+
+    auto voltage = std::max(
+            getMembraneVoltage(neuronId, time) + epsp * neuronType.epspOverrideScaleFactor,
+            neuronType.voltageFloor);
+
+    voltages[neuronId] = voltage;
+    lastTimes[neuronId] = time;
+
+    if (voltage >= neuronType.thresholdVoltage) {
+        pushFiringThresholdEvalCandidate(neuronId);
+    }
+}
+
+// a neuron with continuous inhibition stays a separate candidate for each threshold crossing
+void ClockDrivenInferenceEngine::pushFiringThresholdEvalCandidate(SizeType neuronId) noexcept {
+    if (!isThresholdEvalPending[neuronId] || hasContinuousInhibition(neuronId)) {
+        isThresholdEvalPending[neuronId] = true;
+        firingThresholdEvalCandidates.push_back(static_cast<uint32_t>(neuronId));
+    }
+}
+
+ValueType ClockDrivenInferenceEngine::getMembraneVoltage(SizeType neuronId, TimeType time) const noexcept {
+
+    auto lastTime = lastTimes[neuronId];
+
+    if (time <= lastTime) {
+        return voltages[neuronId];
+    }
+
+    const auto& neuronType = neuronTypes[neuronTypeIds[neuronId]];
+
+    // a spike of a continuous inhibition source since the last update resets the voltage
+    for (auto i = inhibitionSourceOffsets[neuronId]; i < inhibitionSourceOffsets[neuronId + 1]; ++i) {
+        if (lastSpikeTimes[inhibitionSourceIds[i]] >= lastTime) {
+            return neuronType.resetVoltage;
+        }
+    }
+
+    return voltages[neuronId] * exp(- (time - lastTime) * neuronType.timeConstantInverse);
+}
+
+ValueType ClockDrivenInferenceEngine::getContinuousInhibition(SizeType neuronId, TimeType time) const noexcept {
+    ValueType continuousInhibition = 0;
+
+    for (auto i = inhibitionSourceOffsets[neuronId]; i < inhibitionSourceOffsets[neuronId + 1]; ++i) {
+        continuousInhibition += getMembraneVoltage(inhibitionSourceIds[i], time);
+    }
+
+    return continuousInhibition;
+}
+
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include "BatchedRingBuffer.hpp"
+#include "FiringThresholdEvalStats.hpp"
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+
+namespace soft_npu {
+
+class Population;
+class EventProcessor;
+struct CycleContext;
+
+// Inference-only engine for a trained population that switches between event-driven and clock-driven updates cycle by
+// cycle (see the clockDrivenInference params section). Cycles with fewer transmission events per neuron than
+// minEventDensity are processed event by event, with the voltage arithmetic of the double engine. Denser cycles first
+// sum the epsps of the cycle per target neuron, then update all neurons in one sequential pass, decaying voltages that
+// were current at the previous cycle by one constant factor per neuron type. In these cycles the voltage floor applies
+// to the summed input rather than to each epsp, and threshold evaluation candidates are taken in neuron id order, so
+// results differ slightly from the double engine. Inputs and spikes go through the event processor and the cycle output
+// buffer as with the quantized engine. Short-term plasticity is not supported.
+class ClockDrivenInferenceEngine : private boost::noncopyable {
+public:
+    ClockDrivenInferenceEngine(const Population& population, TimeType dt, ValueType minEventDensity);
+
+    // the immediate transmission events of the event processor are taken over; its common events are processed last
+    template<bool isTraced = false>
+    void processCycle(const CycleContext& ctx, EventProcessor& eventProcessor);
+
+    ValueType getMinEventDensity() const noexcept {
+        return minEventDensity;
+    }
+
+    uint64_t getNumClockDrivenCycles() const noexcept {
+        return numClockDrivenCycles;
+    }
+
+    uint64_t getNumEventsProcessed() const noexcept {
+        return numEventsProcessed;
+    }
+
+    const FiringThresholdEvalStats& getLastCycleFiringThresholdEvalStats() const noexcept {
+        return lastCycleFiringThresholdEvalStats;
+    }
+
+    const FiringThresholdEvalStats& getTotalFiringThresholdEvalStats() const noexcept {
+        return totalFiringThresholdEvalStats;
+    }
+
+private:
+    static constexpr TimeType noClockDrivenTime = std::numeric_limits<TimeType>::lowest();
+
+    struct NeuronType {
+        ValueType thresholdVoltage;
+        ValueType resetVoltage;
+        ValueType voltageFloor;
+        TimeType refractoryPeriod;
+        TimeType timeConstantInverse;
+        ValueType epspOverrideScaleFactor;
+
+        // the decay over one cycle
+        ValueType decayPerCycle;
+    };
+
+    struct Transmission {
+        uint32_t targetNeuronId;
+        ValueType epsp;
+    };
+
+    void processEventDriven(const CycleContext& ctx, EventProcessor& eventProcessor);
+    void processClockDriven(const CycleContext& ctx, EventProcessor& eventProcessor);
+    void processFiringThresholdEvalCandidates(const CycleContext& ctx);
+    void fire(const CycleContext& ctx, SizeType neuronId);
+
+    void produceEPSP(TimeType time, SizeType neuronId, ValueType epsp) noexcept;
+    void pushFiringThresholdEvalCandidate(SizeType neuronId) noexcept;
+    ValueType getMembraneVoltage(SizeType neuronId, TimeType time) const noexcept;
+    ValueType getContinuousInhibition(SizeType neuronId, TimeType time) const noexcept;
+
+    bool hasContinuousInhibition(SizeType neuronId) const noexcept {
+        return inhibitionSourceOffsets[neuronId] != inhibitionSourceOffsets[neuronId + 1];
+    }
+
+    const ValueType minEventDensity;
+    const SizeType populationSize;
+
+    std::vector<NeuronType> neuronTypes;
+
+    // indexed by neuron id
+    std::vector<uint32_t> neuronTypeIds;
+    std::vector<ValueType> voltages;
+    // the time the voltage was last updated at, or the end of the refractory period
+    std::vector<TimeType> lastTimes;
+    std::vector<TimeType> lastSpikeTimes;
+    std::vector<char> isThresholdEvalPending;
+    // the summed epsps of a clock-driven cycle, already scaled by the epsp override scale factor
+    std::vector<ValueType> inputs;
+    std::vector<char> hasInput;
+
+    // the outbound synapses of neuron i are [synapseOffsets[i], synapseOffsets[i + 1]), in the order of the population
+    std::vector<SizeType> synapseOffsets;
+    std::vector<uint32_t> postSynapticNeuronIds;
+    std::vector<uint16_t> delayNumCycles;
+    // inhibitory weights are negative
+    std::vector<ValueType> weights;
+
+    // the continuous inhibition sources of neuron i are [inhibitionSourceOffsets[i], inhibitionSourceOffsets[i + 1])
+    std::vector<SizeType> inhibitionSourceOffsets;
+    std::vector<uint32_t> inhibitionSourceIds;
+
+    BatchedRingBuffer<Transmission> transmissionBuffer;
+    std::vector<uint32_t> firingThresholdEvalCandidates;
+    FiringThresholdEvalStats lastCycleFiringThresholdEvalStats;
+    FiringThresholdEvalStats totalFiringThresholdEvalStats;
+    uint64_t numEventsProcessed;
+    uint64_t numClockDrivenCycles;
+
+    // the time of the previous cycle if it was clock-driven, so that the voltages updated then decay by one factor
+    TimeType lastClockDrivenTime;
+};
+
+}
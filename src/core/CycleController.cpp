@@ -3,19 +3,38 @@
 #include <neuro/ChannelProjectorFactory.hpp>
 #include <neuro/Population.hpp>
 #include "CommonEvent.hpp"
+#include "PartitionSynchronizer.hpp"
+#include <util/Tracer.hpp>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 namespace soft_npu {
 
 void setupSpikeRecording(
         Population& population,
         Recordings& recordings) {
-    population.addSpikeListener([&recordings](const CycleContext& cycleContext, const Neuron& neuron) {
-        recordings.neuronSpikeRecordings.emplace_back(cycleContext.time, neuron.getNeuronId());
+    std::vector<bool> isInhibitoryByNeuronId;
 
-        if (neuron.getNeuronParams()->isInhibitory) {
-            ++ recordings.numInhibitorySpikes;
-        } else {
-            ++ recordings.numExcitatorySpikes;
+    std::transform(
+            population.cbeginNeurons(),
+            population.cendNeurons(),
+            std::back_inserter(isInhibitoryByNeuronId),
+            [](const auto& neuron) {
+                return neuron != nullptr && neuron->getNeuronParams()->isInhibitory;
+            });
+
+    population.addSpikeListener([&recordings, isInhibitoryByNeuronId = std::move(isInhibitoryByNeuronId)](
+            const CycleContext& cycleContext, const std::vector<SizeType>& spikingNeuronIds) {
+
+        for (auto neuronId : spikingNeuronIds) {
+            recordings.neuronSpikeRecordings.emplace_back(cycleContext.time, neuronId);
+
+            if (isInhibitoryByNeuronId[neuronId]) {
+                ++ recordings.numInhibitorySpikes;
+            } else {
+                ++ recordings.numExcitatorySpikes;
+            }
         }
     });
 }
@@ -27,6 +46,10 @@ void pushVoltageRecordingEvents(Recordings& recordings,
     for (const auto& neuronIdAndTime : neuronIdTimePairsToRecordVoltageAt) {
         auto neuronId = neuronIdAndTime.first;
 
+        if (!population.isLocal(neuronId)) {
+            continue;
+        }
+
         eventProcessor.pushCommonEvent(neuronIdAndTime.second, makeCommonEvent(
         [&recordings, neuronId, &population](const CycleContext& cycleContext) {
             auto voltage = population.getNeuronById(neuronId).getMembraneVoltage(cycleContext.time);
@@ -35,26 +58,130 @@ void pushVoltageRecordingEvents(Recordings& recordings,
     }
 }
 
+static SizeType getLoadSampleIntervalNumCycles(const ParamsType& params, TimeType dt) {
+    auto it = params["eventProcessor"].find("loadSampleInterval");
+    return it == params["eventProcessor"].end() ? 0 : std::max(static_cast<SizeType>(1), static_cast<SizeType>(
+            std::round(it->get<TimeType>() / dt)));
+}
+
+// bins of firingRateMonitor.binWidth (default 1 ms) covering firingRateMonitor.window
+static FiringRateMonitor makeFiringRateMonitor(const ParamsType& params, const Population& population, TimeType dt) {
+    auto it = params.find("firingRateMonitor");
+    if (it == params.end()) {
+        return FiringRateMonitor();
+    }
+
+    auto binWidthIt = it->find("binWidth");
+    TimeType binWidth = binWidthIt == it->end() ? 1e-3 : binWidthIt->get<TimeType>();
+    TimeType window = (*it)["window"];
+
+    auto binNumCycles = std::max(static_cast<SizeType>(1), static_cast<SizeType>(std::round(binWidth / dt)));
+    auto numBins = std::max(static_cast<SizeType>(1), static_cast<SizeType>(std::round(window / (binNumCycles * dt))));
+
+    return FiringRateMonitor(dt, binNumCycles, numBins, FiringRateMonitor::makeStandardNeuronGroups(population));
+}
+
+// excitatory weights every weightRecorder.sampleInterval, written to weightRecorder.file
+static WeightRecorder makeWeightRecorder(const ParamsType& params, const Population& population, TimeType dt) {
+    auto it = params.find("weightRecorder");
+    if (it == params.end()) {
+        return WeightRecorder();
+    }
+
+    TimeType sampleInterval = (*it)["sampleInterval"];
+    auto sampleIntervalNumCycles = std::max(static_cast<SizeType>(1), static_cast<SizeType>(std::round(sampleInterval / dt)));
+
+    return WeightRecorder(population, sampleIntervalNumCycles, (*it)["file"]);
+}
+
+// inference mode freezes all weights: no STDP, eligibility traces or dopamine release
+bool isInferenceModeEnabled(const ParamsType& params) {
+    auto it = params["simulation"].find("inferenceMode");
+    return it != params["simulation"].end() && it->get<bool>();
+}
+
+// quantizedInference.weightBits (8 or 16), only in inference mode
+static std::unique_ptr<QuantizedInferenceEngine> makeQuantizedInferenceEngine(
+        const ParamsType& params,
+        const Population& population,
+        TimeType dt,
+        bool hasVoltageRecordings) {
+    auto it = params.find("quantizedInference");
+    if (it == params.end()) {
+        return nullptr;
+    }
+
+    if (!isInferenceModeEnabled(params)) {
+        throw std::runtime_error("Quantized inference requires simulation.inferenceMode");
+    }
+
+    if (hasVoltageRecordings) {
+        throw std::runtime_error("Voltages cannot be recorded with quantized inference");
+    }
+
+    return std::make_unique<QuantizedInferenceEngine>(population, dt, (*it)["weightBits"].get<SizeType>());
+}
+
+// clockDrivenInference.minEventDensity, the transmission events per neuron from which a cycle is clock-driven, only in
+// inference mode
+static std::unique_ptr<ClockDrivenInferenceEngine> makeClockDrivenInferenceEngine(
+        const ParamsType& params,
+        const Population& population,
+        TimeType dt,
+        bool hasVoltageRecordings) {
+    auto it = params.find("clockDrivenInference");
+    if (it == params.end()) {
+        return nullptr;
+    }
+
+    if (!isInferenceModeEnabled(params)) {
+        throw std::runtime_error("Clock-driven inference requires simulation.inferenceMode");
+    }
+
+    if (params.find("quantizedInference") != params.end()) {
+        throw std::runtime_error("Clock-driven inference cannot be combined with quantized inference");
+    }
+
+    if (hasVoltageRecordings) {
+        throw std::runtime_error("Voltages cannot be recorded with clock-driven inference");
+    }
+
+    return std::make_unique<ClockDrivenInferenceEngine>(population, dt, (*it)["minEventDensity"].get<ValueType>());
+}
+
 CycleController::CycleController(const ParamsType& params,
-                                 RandomEngineType& randomEngine,
                                  Population& population,
                                  bool recordSpikes,
                                  const std::vector<std::pair<SizeType, TimeType>>& neuronIdTimePairsToRecordVoltageAt,
                                  SynapticTransmissionStats& synapticTransmissionStats) :
         dt(params["cycleController"]["dt"]),
+        isInferenceMode(isInferenceModeEnabled(params)),
+        traceCycleSampleInterval(Tracer::isEnabled() ? Tracer::getCycleSampleInterval() : 0),
         currentCycle(0),
         currentTime(0),
-        nonCoherentStimulator(params, randomEngine, population, dt),
+        eventLoadStats(getLoadSampleIntervalNumCycles(params, dt)),
+        firingRateMonitor(makeFiringRateMonitor(params, population, dt)),
+        weightRecorder(makeWeightRecorder(params, population, dt)),
+        nonCoherentStimulator(params, population, dt),
         eventProcessor(params, dt, synapticTransmissionStats),
-        dopaminergicModulator(params, population),
+        dopaminergicModulator(isInferenceMode ? nullptr : std::make_unique<DAergicModulator>(params, population)),
         staticContext(
                 eventProcessor,
-                dopaminergicModulator,
+                dopaminergicModulator.get(),
                 population,
                 cycleOutputBuffer,
-                synapticTransmissionStats),
-        recordings(std::make_shared<Recordings>())
+                synapticTransmissionStats,
+                phaseTimers,
+                eventLoadStats),
+        quantizedInferenceEngine(makeQuantizedInferenceEngine(
+                params, population, dt, !neuronIdTimePairsToRecordVoltageAt.empty())),
+        clockDrivenInferenceEngine(makeClockDrivenInferenceEngine(
+                params, population, dt, !neuronIdTimePairsToRecordVoltageAt.empty())),
+        recordings(std::make_shared<Recordings>()),
+        partitionSynchronizer(nullptr)
                                  {
+    population.bindContinuousInhibitions();
+
     if (recordSpikes) {
         setupSpikeRecording(population, *recordings);
     }
@@ -63,23 +190,84 @@ CycleController::CycleController(const ParamsType& params,
 }
 
 void CycleController::runCycle() {
+    // decided once per cycle, so that the phases of cycles not sampled for tracing carry no tracing code
+    if (traceCycleSampleInterval > 0 && currentCycle % traceCycleSampleInterval == 0) {
+        runPhases<true>();
+    } else {
+        runPhases<false>();
+    }
+}
+
+template<bool isTraced>
+void CycleController::runPhases() {
 
     cycleOutputBuffer.reset();
 
     const CycleContext ctx(dt * currentCycle, staticContext, currentCycle);
 
-    for (auto it = cycleInputBuffer.cbeginSpikingChannelIds(); it != cycleInputBuffer.cendSpikingChannelIds(); ++it) {
-        staticContext.population.projectChannelSpike(ctx, *it);
+    {
+        ScopedPhaseTimer phaseTimer(phaseTimers, CyclePhase::channelProjection);
+        ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::channelProjection, currentCycle);
+
+        for (auto it = cycleInputBuffer.cbeginSpikingChannelIds(); it != cycleInputBuffer.cendSpikingChannelIds(); ++it) {
+            staticContext.population.projectChannelSpike(ctx, *it);
+        }
+    }
+
+    if (isInferenceMode) {
+        if (cycleInputBuffer.getReward() != 0) {
+            throw std::runtime_error("Reward doses are not supported in inference mode");
+        }
+
+        processStimulationAndEvents<false, isTraced>(ctx);
+    } else {
+        dopaminergicModulator->processReward(ctx, cycleInputBuffer.getReward());
+        processStimulationAndEvents<true, isTraced>(ctx);
+    }
+
+    if (partitionSynchronizer != nullptr) {
+        partitionSynchronizer->onCycleEvents(ctx);
     }
 
-    dopaminergicModulator.processReward(ctx, cycleInputBuffer.getReward());
+    // recorded in inference mode as well, where it stays empty, so that all queues have one sample per cycle
+    eventLoadStats.record(
+            EventQueue::eligibilityTraces, isInferenceMode ? 0 : dopaminergicModulator->getNumEligibilityTraces());
+
+    if (!isInferenceMode) {
+        ScopedPhaseTimer phaseTimer(phaseTimers, CyclePhase::dopamineRelease);
+        ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::dopamineRelease, currentCycle);
+        dopaminergicModulator->processCycle(ctx);
+    }
 
-    nonCoherentStimulator.processCycle(ctx);
-    eventProcessor.processCycle(ctx);
-    dopaminergicModulator.processCycle(ctx);
+    voltageProbe.onCycleEnd(currentCycle, ctx.time);
+    weightRecorder.onCycleEnd(currentCycle, ctx.time);
 
     ++ currentCycle;
     currentTime = currentCycle * dt;
+
+    eventLoadStats.onCycleEnd(currentTime);
+    firingRateMonitor.onCycleEnd(cycleOutputBuffer);
+}
+
+template<bool isPlastic, bool isTraced>
+void CycleController::processStimulationAndEvents(const CycleContext& ctx) {
+    {
+        ScopedPhaseTimer phaseTimer(phaseTimers, CyclePhase::nonCoherentStimulation);
+        ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::nonCoherentStimulation, ctx.cycleId);
+        nonCoherentStimulator.processCycle(ctx);
+    }
+
+    if (quantizedInferenceEngine != nullptr) {
+        quantizedInferenceEngine->processCycle<isTraced>(ctx, eventProcessor);
+    } else if (clockDrivenInferenceEngine != nullptr) {
+        clockDrivenInferenceEngine->processCycle<isTraced>(ctx, eventProcessor);
+    } else {
+        eventProcessor.processCycle<isPlastic, isTraced>(ctx);
+    }
+
+    ScopedPhaseTimer phaseTimer(phaseTimers, CyclePhase::spikeListeners);
+    ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::spikeListeners, ctx.cycleId);
+    staticContext.population.onCycleSpikes(ctx, cycleOutputBuffer.getSpikingNeuronIds());
 }
 
 std::shared_ptr<const Recordings> CycleController::getRecordings() const noexcept {
@@ -91,7 +279,86 @@ TimeType CycleController::getTime() const noexcept {
 }
 
 uint64_t CycleController::getNumEventsProcessed() const noexcept {
-    return eventProcessor.getNumEventsProcessed();
+    return eventProcessor.getNumEventsProcessed() +
+        (quantizedInferenceEngine != nullptr ? quantizedInferenceEngine->getNumEventsProcessed() : 0) +
+        (clockDrivenInferenceEngine != nullptr ? clockDrivenInferenceEngine->getNumEventsProcessed() : 0);
+}
+
+const FiringThresholdEvalStats& CycleController::getLastCycleFiringThresholdEvalStats() const noexcept {
+    return quantizedInferenceEngine != nullptr ?
+        quantizedInferenceEngine->getLastCycleFiringThresholdEvalStats() :
+        clockDrivenInferenceEngine != nullptr ?
+        clockDrivenInferenceEngine->getLastCycleFiringThresholdEvalStats() :
+        eventProcessor.getLastCycleFiringThresholdEvalStats();
+}
+
+const FiringThresholdEvalStats& CycleController::getTotalFiringThresholdEvalStats() const noexcept {
+    return quantizedInferenceEngine != nullptr ?
+        quantizedInferenceEngine->getTotalFiringThresholdEvalStats() :
+        clockDrivenInferenceEngine != nullptr ?
+        clockDrivenInferenceEngine->getTotalFiringThresholdEvalStats() :
+        eventProcessor.getTotalFiringThresholdEvalStats();
+}
+
+const PhaseTimers& CycleController::getPhaseTimers() const noexcept {
+    return phaseTimers;
+}
+
+const EventLoadStats& CycleController::getEventLoadStats() const noexcept {
+    return eventLoadStats;
+}
+
+const FiringRateMonitor& CycleController::getFiringRateMonitor() const noexcept {
+    return firingRateMonitor;
+}
+
+void CycleController::setVoltageProbe(VoltageProbe voltageProbe) {
+    if (quantizedInferenceEngine != nullptr) {
+        throw std::runtime_error("Voltages cannot be probed with quantized inference");
+    }
+
+    if (clockDrivenInferenceEngine != nullptr) {
+        throw std::runtime_error("Voltages cannot be probed with clock-driven inference");
+    }
+
+    this->voltageProbe = std::move(voltageProbe);
+}
+
+const VoltageProbe& CycleController::getVoltageProbe() const noexcept {
+    return voltageProbe;
+}
+
+VoltageSamples CycleController::finishVoltageProbe() {
+    return voltageProbe.finish();
+}
+
+const WeightRecorder& CycleController::getWeightRecorder() const noexcept {
+    return weightRecorder;
+}
+
+void CycleController::finishWeightRecording() {
+    weightRecorder.finish();
+}
+
+void CycleController::setPartitionSynchronizer(PartitionSynchronizer& partitionSynchronizer) {
+    if (quantizedInferenceEngine != nullptr) {
+        throw std::runtime_error("Quantized inference cannot be used with partitions");
+    }
+
+    if (clockDrivenInferenceEngine != nullptr) {
+        throw std::runtime_error("Clock-driven inference cannot be used with partitions");
+    }
+
+    this->partitionSynchronizer = &partitionSynchronizer;
+    eventProcessor.trackEventOrder();
+}
+
+bool CycleController::isDopamineReleaseDue(SizeType cycleId) const noexcept {
+    return !isInferenceMode && dopaminergicModulator->getNextReleaseTime() <= dt * cycleId;
+}
+
+SizeType CycleController::getNumCycles(TimeType delay) const noexcept {
+    return eventProcessor.getTargetOffset(delay);
 }
 
 CycleInputBuffer& CycleController::getCycleInputBuffer() {
@@ -102,16 +369,26 @@ CycleOutputBuffer& CycleController::getCycleOutputBuffer() {
     return cycleOutputBuffer;
 }
 
-void CycleController::setNonCoherentStimulationRate(ValueType rate) noexcept {
+void CycleController::setNonCoherentStimulationRate(ValueType rate) {
     nonCoherentStimulator.setRate(rate);
 }
 
 void CycleController::setDopamineReleaseBaseRate(ValueType rate) noexcept {
-    dopaminergicModulator.setDopamineReleaseBaseRate(rate);
+    if (!isInferenceMode) {
+        dopaminergicModulator->setDopamineReleaseBaseRate(rate);
+    }
 }
 
 TimeType CycleController::getTimeIncrement() const noexcept {
     return dt;
 }
 
+const QuantizedInferenceEngine* CycleController::getQuantizedInferenceEngine() const noexcept {
+    return quantizedInferenceEngine.get();
+}
+
+const ClockDrivenInferenceEngine* CycleController::getClockDrivenInferenceEngine() const noexcept {
+    return clockDrivenInferenceEngine.get();
+}
+
 }
@@ -6,17 +6,25 @@
 #include "CycleInputBuffer.hpp"
 #include "CycleOutputBuffer.hpp"
 #include "NonCoherentStimulator.hpp"
+#include "PhaseTimers.hpp"
+#include "EventLoadStats.hpp"
+#include "FiringRateMonitor.hpp"
+#include "VoltageProbe.hpp"
+#include "WeightRecorder.hpp"
+#include "QuantizedInferenceEngine.hpp"
+#include "ClockDrivenInferenceEngine.hpp"
+#include <memory>
 #include <boost/core/noncopyable.hpp>
 
 namespace soft_npu {
 
 struct Recordings;
+class PartitionSynchronizer;
 
 class CycleController : private boost::noncopyable {
 public:
     CycleController(
             const ParamsType& params,
-            RandomEngineType& randomEngine,
             Population& population,
             bool recordSpikes,
             const std::vector<std::pair<SizeType, TimeType>>& neuronIdTimePairsToRecordVoltageAt,
@@ -29,24 +37,68 @@ public:
     TimeType getTime() const noexcept;
     std::shared_ptr<const Recordings> getRecordings() const noexcept;
     uint64_t getNumEventsProcessed() const noexcept;
+    const FiringThresholdEvalStats& getLastCycleFiringThresholdEvalStats() const noexcept;
+    const FiringThresholdEvalStats& getTotalFiringThresholdEvalStats() const noexcept;
+    const PhaseTimers& getPhaseTimers() const noexcept;
+    const EventLoadStats& getEventLoadStats() const noexcept;
 
-    void setNonCoherentStimulationRate(ValueType rate) noexcept;
+    // disabled unless configured, queryable between cycles
+    const FiringRateMonitor& getFiringRateMonitor() const noexcept;
+
+    void setVoltageProbe(VoltageProbe voltageProbe);
+    const VoltageProbe& getVoltageProbe() const noexcept;
+    VoltageSamples finishVoltageProbe();
+
+    // disabled unless configured
+    const WeightRecorder& getWeightRecorder() const noexcept;
+    void finishWeightRecording();
+
+    // partitioned simulation: the synchronizer is called every cycle once the events have been processed, before
+    // dopamine is released, and delivers the synaptic transmission events of all spikes
+    void setPartitionSynchronizer(PartitionSynchronizer& partitionSynchronizer);
+    bool isDopamineReleaseDue(SizeType cycleId) const noexcept;
+    SizeType getNumCycles(TimeType delay) const noexcept;
+
+    void setNonCoherentStimulationRate(ValueType rate);
+    // has no effect in inference mode
     void setDopamineReleaseBaseRate(ValueType rate) noexcept;
     TimeType getTimeIncrement() const noexcept;
 
+    // null unless configured
+    const QuantizedInferenceEngine* getQuantizedInferenceEngine() const noexcept;
+    const ClockDrivenInferenceEngine* getClockDrivenInferenceEngine() const noexcept;
+
 private:
+    template<bool isTraced>
+    void runPhases();
+
+    template<bool isPlastic, bool isTraced>
+    void processStimulationAndEvents(const CycleContext& ctx);
 
     TimeType dt;
+    bool isInferenceMode;
+    // 0 unless a trace was being recorded when the controller was created
+    const SizeType traceCycleSampleInterval;
     SizeType currentCycle;
     TimeType currentTime;
 
+    PhaseTimers phaseTimers;
+    EventLoadStats eventLoadStats;
+    FiringRateMonitor firingRateMonitor;
+    VoltageProbe voltageProbe;
+    WeightRecorder weightRecorder;
     CycleInputBuffer cycleInputBuffer;
     CycleOutputBuffer cycleOutputBuffer;
     NonCoherentStimulator nonCoherentStimulator;
     EventProcessor eventProcessor;
-    DAergicModulator dopaminergicModulator;
+    // not created in inference mode, which neither collects eligibility traces nor releases dopamine
+    std::unique_ptr<DAergicModulator> dopaminergicModulator;
     const StaticContext staticContext;
+    // replaces the event processor's transmission and threshold stages when configured
+    std::unique_ptr<QuantizedInferenceEngine> quantizedInferenceEngine;
+    std::unique_ptr<ClockDrivenInferenceEngine> clockDrivenInferenceEngine;
     std::shared_ptr<Recordings> recordings;
+    PartitionSynchronizer* partitionSynchronizer;
 };
 
 }
@@ -6,8 +6,13 @@ void CycleOutputBuffer::addSpike(SizeType channelId) {
     spikingChannelIds.push_back(channelId);
 }
 
+void CycleOutputBuffer::addNeuronSpike(SizeType neuronId) {
+    spikingNeuronIds.push_back(neuronId);
+}
+
 void CycleOutputBuffer::reset() noexcept {
     spikingChannelIds.clear();
+    spikingNeuronIds.clear();
 }
 
 }
@@ -8,6 +8,7 @@ namespace soft_npu {
 class CycleOutputBuffer : private boost::noncopyable {
 public:
     void addSpike(SizeType channelId);
+    void addNeuronSpike(SizeType neuronId);
     void reset() noexcept;
 
     auto cbeginSpikingChannelIds() const noexcept {
@@ -18,8 +19,13 @@ public:
         return spikingChannelIds.cend();
     }
 
+    const std::vector<SizeType>& getSpikingNeuronIds() const noexcept {
+        return spikingNeuronIds;
+    }
+
 private:
     std::vector<SizeType> spikingChannelIds;
+    std::vector<SizeType> spikingNeuronIds;
 };
 
 }
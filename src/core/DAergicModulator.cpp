@@ -88,4 +88,12 @@ void DAergicModulator::setDopamineReleaseBaseRate(ValueType targetRate) noexcept
     dopamineReleaseBaseRate = targetRate;
 }
 
+SizeType DAergicModulator::getNumEligibilityTraces() const noexcept {
+    return eligibilityTraceBuffer.size();
+}
+
+TimeType DAergicModulator::getNextReleaseTime() const noexcept {
+    return nextDAReleaseTime;
+}
+
 }
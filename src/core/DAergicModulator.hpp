@@ -15,6 +15,10 @@ public:
     void processReward(const CycleContext& ctx, ValueType amount);
     void processCycle(const CycleContext&);
     void setDopamineReleaseBaseRate(ValueType rate) noexcept;
+    SizeType getNumEligibilityTraces() const noexcept;
+
+    // dopamine is released in the first cycle at or after this time
+    TimeType getNextReleaseTime() const noexcept;
 
 private:
     std::deque<EligibilityTrace> eligibilityTraceBuffer;
@@ -0,0 +1,62 @@
+#include "EventLoadStats.hpp"
+#include <stdexcept>
+
+namespace soft_npu {
+
+const char* toString(EventQueue queue) {
+    switch (queue) {
+        case EventQueue::transmissionEventsPerSlot:
+            return "transmission events per slot";
+        case EventQueue::thresholdEvalCandidates:
+            return "threshold evaluation candidates";
+        case EventQueue::commonEvents:
+            return "common events";
+        case EventQueue::eligibilityTraces:
+            return "eligibility traces";
+        default:
+            throw std::runtime_error("Unknown event queue");
+    }
+}
+
+EventLoadStats::EventLoadStats(SizeType sampleIntervalNumCycles) noexcept :
+        sampleIntervalNumCycles(sampleIntervalNumCycles),
+        numCyclesInCurrentSample(0),
+        currentSample{0, {}} {
+}
+
+EventLoadStats::EventLoadStats(
+        const std::array<QueueLoadStats, static_cast<SizeType>(EventQueue::numQueues)>& queueLoadStats,
+        std::vector<EventLoadSample> samples) noexcept :
+        sampleIntervalNumCycles(0),
+        numCyclesInCurrentSample(0),
+        queueLoadStats(queueLoadStats),
+        currentSample{0, {}},
+        samples(std::move(samples)) {
+}
+
+void EventLoadStats::onCycleEnd(TimeType time) {
+    if (sampleIntervalNumCycles > 0 && ++ numCyclesInCurrentSample == sampleIntervalNumCycles) {
+        currentSample.time = time;
+        samples.push_back(currentSample);
+        currentSample.maxSizes = {};
+        numCyclesInCurrentSample = 0;
+    }
+}
+
+void EventLoadStats::merge(const EventLoadStats& other) {
+    for (SizeType queueIndex = 0; queueIndex < queueLoadStats.size(); ++queueIndex) {
+        queueLoadStats[queueIndex].merge(other.queueLoadStats[queueIndex]);
+    }
+
+    for (SizeType i = 0; i < other.samples.size(); ++i) {
+        if (i == samples.size()) {
+            samples.push_back(other.samples[i]);
+        } else {
+            for (SizeType queueIndex = 0; queueIndex < queueLoadStats.size(); ++queueIndex) {
+                samples[i].maxSizes[queueIndex] = std::max(samples[i].maxSizes[queueIndex], other.samples[i].maxSizes[queueIndex]);
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace soft_npu {
+
+enum class EventQueue : SizeType {
+    transmissionEventsPerSlot,
+    thresholdEvalCandidates,
+    commonEvents,
+    eligibilityTraces,
+    numQueues
+};
+
+const char* toString(EventQueue);
+
+// Distribution of the size of a queue over cycles. Histogram bucket 0 counts cycles with an empty queue, bucket k > 0
+// counts cycles with a size in [2^(k-1), 2^k).
+class QueueLoadStats {
+public:
+    static constexpr SizeType numBuckets = 65;
+
+    void record(SizeType size) noexcept {
+        highWaterMark = std::max(highWaterMark, size);
+        ++ histogram[getBucket(size)];
+    }
+
+    static SizeType getBucket(SizeType size) noexcept {
+        return size == 0 ? 0 : 64 - __builtin_clzll(size);
+    }
+
+    static SizeType getBucketLowerBound(SizeType bucket) noexcept {
+        return bucket == 0 ? 0 : static_cast<SizeType>(1) << (bucket - 1);
+    }
+
+    SizeType getHighWaterMark() const noexcept {
+        return highWaterMark;
+    }
+
+    const std::array<SizeType, numBuckets>& getHistogram() const noexcept {
+        return histogram;
+    }
+
+    // combines the distribution of another queue over the same cycles
+    void merge(const QueueLoadStats& other) noexcept {
+        highWaterMark = std::max(highWaterMark, other.highWaterMark);
+        for (SizeType bucket = 0; bucket < numBuckets; ++bucket) {
+            histogram[bucket] += other.histogram[bucket];
+        }
+    }
+
+private:
+    SizeType highWaterMark = 0;
+    std::array<SizeType, numBuckets> histogram{};
+};
+
+struct EventLoadSample {
+    TimeType time;
+    std::array<SizeType, static_cast<SizeType>(EventQueue::numQueues)> maxSizes;
+};
+
+// Records the queue sizes of the event processor and the dopaminergic modulator once per cycle. With a positive
+// sample interval, the maximum size of each queue within every interval is kept as a time series.
+class EventLoadStats {
+public:
+    explicit EventLoadStats(SizeType sampleIntervalNumCycles) noexcept;
+
+    // of stats recorded elsewhere, such as by another process
+    EventLoadStats(
+            const std::array<QueueLoadStats, static_cast<SizeType>(EventQueue::numQueues)>& queueLoadStats,
+            std::vector<EventLoadSample> samples) noexcept;
+
+    void record(EventQueue queue, SizeType size) noexcept {
+        auto queueIndex = static_cast<SizeType>(queue);
+        queueLoadStats[queueIndex].record(size);
+        currentSample.maxSizes[queueIndex] = std::max(currentSample.maxSizes[queueIndex], size);
+    }
+
+    void onCycleEnd(TimeType time);
+
+    // combines the stats of another process simulating a part of the same population over the same cycles
+    void merge(const EventLoadStats& other);
+
+    const QueueLoadStats& getQueueLoadStats(EventQueue queue) const noexcept {
+        return queueLoadStats[static_cast<SizeType>(queue)];
+    }
+
+    const std::vector<EventLoadSample>& getSamples() const noexcept {
+        return samples;
+    }
+
+private:
+    SizeType sampleIntervalNumCycles;
+    SizeType numCyclesInCurrentSample;
+    std::array<QueueLoadStats, static_cast<SizeType>(EventQueue::numQueues)> queueLoadStats;
+    EventLoadSample currentSample;
+    std::vector<EventLoadSample> samples;
+};
+
+}
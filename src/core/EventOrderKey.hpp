@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <limits>
+#include <tuple>
+
+namespace soft_npu {
+
+// Position of a transmission event among the events processed in one cycle: events are processed in the order of the
+// spikes that caused them and, per spike, in the order of the outbound synapses, followed by the immediate events of
+// the cycle. Partitioned simulations carry the key along with each event, to restore this order across partitions.
+struct EventOrderKey {
+    static constexpr SizeType immediateSpikeCycleId = std::numeric_limits<SizeType>::max();
+
+    static EventOrderKey makeImmediate(SizeType immediateEventIndex) noexcept {
+        return {immediateSpikeCycleId, immediateEventIndex, 0};
+    }
+
+    bool isImmediate() const noexcept {
+        return spikeCycleId == immediateSpikeCycleId;
+    }
+
+    SizeType spikeCycleId;
+
+    // of the spike among all spikes of its cycle, or of the event among the immediate events of its cycle
+    SizeType spikeRank;
+
+    SizeType synapseIndex;
+};
+
+inline bool operator<(const EventOrderKey& lhs, const EventOrderKey& rhs) noexcept {
+    return std::tie(lhs.spikeCycleId, lhs.spikeRank, lhs.synapseIndex) <
+           std::tie(rhs.spikeCycleId, rhs.spikeRank, rhs.synapseIndex);
+}
+
+}
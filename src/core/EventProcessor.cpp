@@ -2,6 +2,9 @@
 #include "EventProcessor.hpp"
 #include "TransmissionEvent.hpp"
 #include "CommonEvent.hpp"
+#include "PhaseTimers.hpp"
+#include "EventLoadStats.hpp"
+#include "StaticContext.hpp"
 
 namespace soft_npu {
 
@@ -26,13 +29,31 @@ EventProcessor::EventProcessor(const ParamsType& params, TimeType dt,
 EventProcessor::EventProcessor(TimeType dt, TimeType lookAheadWindow, SizeType subBufferReserveSlots,
                                SynapticTransmissionStats& synapticTransmissionStats) :
         transmissionEventBuffer(makeBuffer<TransmissionEvent>(dt, lookAheadWindow, subBufferReserveSlots)),
+        isTrackingEventOrder(false),
+        eventOrderKeyBuffer(makeBuffer<EventOrderKey>(dt, lookAheadWindow, 0)),
+        currentEventOrderKey(),
+        numImmediateEventsInCycle(0),
         frequency(1 / dt),
         numEventsProcessed(0),
         synapticTransmissionStats(synapticTransmissionStats) {
 }
 
-void EventProcessor::pushImmediateTransmissionEvent(ValueType epsp, Neuron &targetNeuron) {
-    transmissionEventBuffer.emplaceAtOffset(0, epsp, targetNeuron);
+void EventProcessor::pushImmediateTransmissionEvent(ValueType epsp, Neuron* targetNeuron) {
+    if (isTrackingEventOrder) {
+        auto immediateEventIndex = numImmediateEventsInCycle++;
+
+        if (targetNeuron != nullptr) {
+            eventOrderKeyBuffer.emplaceAtOffset(0, EventOrderKey::makeImmediate(immediateEventIndex));
+        }
+    }
+
+    if (targetNeuron != nullptr) {
+        transmissionEventBuffer.emplaceAtOffset(0, epsp, *targetNeuron);
+    }
+}
+
+void EventProcessor::trackEventOrder() noexcept {
+    isTrackingEventOrder = true;
 }
 
 void EventProcessor::pushCommonEvent(TimeType targetTime, std::unique_ptr<CommonEvent>&& commonEvent) {
@@ -40,34 +61,134 @@ void EventProcessor::pushCommonEvent(TimeType targetTime, std::unique_ptr<Common
 }
 
 
+template<bool isPlastic, bool isTraced>
 void EventProcessor::processCycle(const CycleContext & cycleContext) {
 
-    processBatch(cycleContext, transmissionEventBuffer);
+    auto& phaseTimers = cycleContext.staticContext.phaseTimers;
+    auto& eventLoadStats = cycleContext.staticContext.eventLoadStats;
 
-    for (auto& event : firingThresholdEvalBuffer) {
-        event.process(cycleContext);
+    eventLoadStats.record(EventQueue::transmissionEventsPerSlot, transmissionEventBuffer.sizeAtCurrentLocation());
+
+    {
+        ScopedPhaseTimer phaseTimer(phaseTimers, CyclePhase::transmissionEvents);
+        ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::transmissionEvents, cycleContext.cycleId);
+
+        if (isTrackingEventOrder) {
+            processOrderedBatch<isPlastic>(cycleContext);
+        } else {
+            processBatch<isPlastic>(cycleContext, transmissionEventBuffer);
+        }
     }
-    numEventsProcessed += firingThresholdEvalBuffer.size();
-    firingThresholdEvalBuffer.clear();
 
-    for (;
-            !commonEventsQueue.empty() &&
-            commonEventsQueue.top().targetTime <= cycleContext.time;
-            commonEventsQueue.pop()) {
+    {
+        ScopedPhaseTimer phaseTimer(phaseTimers, CyclePhase::thresholdEvaluation);
+        ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::thresholdEvaluation, cycleContext.cycleId);
+        eventLoadStats.record(EventQueue::thresholdEvalCandidates, firingThresholdEvalCandidates.size());
+        processFiringThresholdEvalCandidates<isPlastic>(cycleContext);
+    }
 
-        commonEventsQueue.top().commonEvent->process(cycleContext);
-        ++ numEventsProcessed;
+    processCommonEventsAndAdvance<isTraced>(cycleContext);
+}
+
+template void EventProcessor::processCycle<true, false>(const CycleContext&);
+template void EventProcessor::processCycle<false, false>(const CycleContext&);
+template void EventProcessor::processCycle<true, true>(const CycleContext&);
+template void EventProcessor::processCycle<false, true>(const CycleContext&);
+
+template<bool isTraced>
+void EventProcessor::processCommonEventsAndAdvance(const CycleContext& cycleContext) {
+
+    {
+        ScopedPhaseTimer phaseTimer(cycleContext.staticContext.phaseTimers, CyclePhase::commonEvents);
+        ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::commonEvents, cycleContext.cycleId);
+        cycleContext.staticContext.eventLoadStats.record(EventQueue::commonEvents, commonEventsQueue.size());
+
+        for (;
+                !commonEventsQueue.empty() &&
+                commonEventsQueue.top().targetTime <= cycleContext.time;
+                commonEventsQueue.pop()) {
+
+            commonEventsQueue.top().commonEvent->process(cycleContext);
+            ++ numEventsProcessed;
+        }
     }
 
     transmissionEventBuffer.clearAndAdvance();
+    eventOrderKeyBuffer.clearAndAdvance();
+    numImmediateEventsInCycle = 0;
+}
+
+template void EventProcessor::processCommonEventsAndAdvance<false>(const CycleContext&);
+template void EventProcessor::processCommonEventsAndAdvance<true>(const CycleContext&);
+
+template<bool isPlastic>
+void EventProcessor::processOrderedBatch(const CycleContext& cycleContext) {
+
+    auto keyIt = eventOrderKeyBuffer.cBeginElementsAtCurrentLocation();
+
+    for (auto cit = transmissionEventBuffer.cBeginElementsAtCurrentLocation(); cit != transmissionEventBuffer.cEndElementsAtCurrentLocation(); ++ cit, ++ keyIt) {
+        currentEventOrderKey = *keyIt;
+        cit->template process<isPlastic>(cycleContext);
+        ++ numEventsProcessed;
+    }
+}
+
+template<bool isPlastic>
+void EventProcessor::processFiringThresholdEvalCandidates(const CycleContext& cycleContext) {
+
+    auto numCandidates = firingThresholdEvalCandidates.size();
+
+    candidateVoltages.resize(numCandidates);
+    candidateThresholdVoltages.resize(numCandidates);
+    candidateIsAboveThreshold.resize(numCandidates);
+
+    for (SizeType i = 0; i < numCandidates; ++i) {
+        candidateVoltages[i] = firingThresholdEvalCandidates[i]->getLastVoltage();
+        candidateThresholdVoltages[i] = firingThresholdEvalCandidates[i]->getThresholdVoltage();
+    }
+
+    for (SizeType i = 0; i < numCandidates; ++i) {
+        candidateIsAboveThreshold[i] = candidateVoltages[i] >= candidateThresholdVoltages[i];
+    }
+
+    // fire in candidate order; neurons with continuous inhibition depend on sources firing earlier in this stage
+    SizeType numSpikes = 0;
+    spikeEventOrderKeys.clear();
+
+    for (SizeType i = 0; i < numCandidates; ++i) {
+        auto neuron = firingThresholdEvalCandidates[i];
+        neuron->clearThresholdEvalPending();
+
+        bool hasFired = false;
+
+        if (neuron->hasContinuousInhibition()) {
+            hasFired = neuron->fireIfAboveThreshold<isPlastic>(cycleContext, cycleContext.time);
+        } else if (candidateIsAboveThreshold[i]) {
+            neuron->fire<isPlastic>(cycleContext);
+            hasFired = true;
+        }
+
+        numSpikes += hasFired;
+
+        if (hasFired && isTrackingEventOrder) {
+            spikeEventOrderKeys.push_back(candidateEventOrderKeys[i]);
+        }
+    }
+
+    firingThresholdEvalCandidates.clear();
+    candidateEventOrderKeys.clear();
+
+    lastCycleFiringThresholdEvalStats.numCandidates = numCandidates;
+    lastCycleFiringThresholdEvalStats.numSpikes = numSpikes;
+    totalFiringThresholdEvalStats.numCandidates += numCandidates;
+    totalFiringThresholdEvalStats.numSpikes += numSpikes;
+    numEventsProcessed += numCandidates;
 }
 
 SizeType EventProcessor::getNumEventsProcessed() const noexcept {
     return numEventsProcessed;
 }
 
-inline void EventProcessor::processBatch(const CycleContext &) {}
-
 EventProcessor::CommonEventWithTargetTime::CommonEventWithTargetTime(TimeType targetTime,
                                                                      std::unique_ptr<CommonEvent> &&commonEvent) :
         targetTime(targetTime), commonEvent(std::move(commonEvent)) {
@@ -5,7 +5,8 @@
 #include "BatchedRingBuffer.hpp"
 #include <Aliases.hpp>
 #include "TransmissionEvent.hpp"
-#include "FiringThresholdEvalEvent.hpp"
+#include "EventOrderKey.hpp"
+#include "FiringThresholdEvalStats.hpp"
 #include <neuro/Neuron.hpp>
 #include <neuro/Synapse.hpp>
 #include "CommonEvent.hpp"
@@ -24,14 +25,42 @@ public:
             SynapticTransmissionStats& synapticTransmissionStats
             );
 
+    // with isPlastic == false, transmissions and spikes skip STDP bookkeeping entirely; with isTraced, the phases are
+    // recorded as trace spans
+    template<bool isPlastic = true, bool isTraced = false>
     void processCycle(const CycleContext&);
 
+    // the last stage of processCycle: the due common events, then the advance to the next cycle
+    template<bool isTraced = false>
+    void processCommonEventsAndAdvance(const CycleContext&);
+
+    // the transmission events of the current cycle, for an engine that processes them in place of processCycle
+    template<typename Function>
+    void forEachTransmissionEventAtCurrentLocation(Function&& function) const {
+        std::for_each(
+                transmissionEventBuffer.cBeginElementsAtCurrentLocation(),
+                transmissionEventBuffer.cEndElementsAtCurrentLocation(),
+                std::forward<Function>(function));
+    }
+
+    SizeType getNumTransmissionEventsAtCurrentLocation() const noexcept {
+        return transmissionEventBuffer.sizeAtCurrentLocation();
+    }
+
     void pushCommonEvent(TimeType targetTime, std::unique_ptr<CommonEvent>&& commonEvent);
 
-    void pushImmediateTransmissionEvent(ValueType epsp, Neuron& targetNeuron);
+    // a null target neuron belongs to another partition of the population; the event only counts towards the
+    // order of the immediate events
+    void pushImmediateTransmissionEvent(ValueType epsp, Neuron* targetNeuron);
 
     void pushFiringThresholdEvalEvent(Neuron& neuron) {
-        firingThresholdEvalBuffer.emplace_back(neuron);
+        if (neuron.markThresholdEvalPending()) {
+            firingThresholdEvalCandidates.push_back(&neuron);
+
+            if (isTrackingEventOrder) {
+                candidateEventOrderKeys.push_back(currentEventOrderKey);
+            }
+        }
     }
 
     void pushSynapticTransmissionEvent(TimeType delay, ValueType epsp, Synapse* synapse, Neuron &targetNeuron) {
@@ -39,8 +68,39 @@ public:
         pushBufferedEvent(delay, transmissionEventBuffer, epsp, synapse, targetNeuron);
     }
 
+    // From now on, every event carries an EventOrderKey, and the keys of the events that made this cycle's spikes
+    // threshold evaluation candidates are kept. Synaptic transmission events must then be pushed through
+    // pushOrderedSynapticTransmissionEvent, in key order per target cycle.
+    void trackEventOrder() noexcept;
+
+    // offset 0 is the cycle following the current one, as the events are pushed once the current cycle is processed
+    void pushOrderedSynapticTransmissionEvent(
+            SizeType offset, ValueType epsp, Synapse* synapse, Neuron& targetNeuron, const EventOrderKey& eventOrderKey) {
+        transmissionEventBuffer.emplaceAtOffset(offset, epsp, synapse, targetNeuron);
+        eventOrderKeyBuffer.emplaceAtOffset(offset, eventOrderKey);
+    }
+
+    // of the events that made the spiking neurons of the last cycle threshold evaluation candidates, in spike order
+    const std::vector<EventOrderKey>& getSpikeEventOrderKeys() const noexcept {
+        return spikeEventOrderKeys;
+    }
+
+    SizeType getTargetOffset(TimeType delay) const noexcept {
+
+        assert(delay >= 0);
+        return std::max(static_cast<SizeType>(1), static_cast<SizeType>(ceil(delay * frequency)));
+    }
+
     SizeType getNumEventsProcessed() const noexcept;
 
+    const FiringThresholdEvalStats& getLastCycleFiringThresholdEvalStats() const noexcept {
+        return lastCycleFiringThresholdEvalStats;
+    }
+
+    const FiringThresholdEvalStats& getTotalFiringThresholdEvalStats() const noexcept {
+        return totalFiringThresholdEvalStats;
+    }
+
 private:
 
     explicit EventProcessor(
@@ -49,23 +109,24 @@ private:
             SizeType subBufferReserveSlots,
             SynapticTransmissionStats& synapticTransmissionStats);
 
-    SizeType getTargetOffset(TimeType delay) const noexcept {
+    template<bool isPlastic>
+    void processBatch(const CycleContext&) {}
 
-        assert(delay >= 0);
-        return std::max(static_cast<SizeType>(1), static_cast<SizeType>(ceil(delay * frequency)));
-    }
+    template<bool isPlastic>
+    void processOrderedBatch(const CycleContext&);
 
-    void processBatch(const CycleContext&);
+    template<bool isPlastic>
+    void processFiringThresholdEvalCandidates(const CycleContext&);
 
-    template<typename ElementType, typename... BufferTypes>
+    template<bool isPlastic, typename ElementType, typename... BufferTypes>
     void processBatch(const CycleContext& cycleContext, BatchedRingBuffer<ElementType>& buffer, BufferTypes&... buffers) {
 
         for (auto cit = buffer.cBeginElementsAtCurrentLocation(); cit != buffer.cEndElementsAtCurrentLocation(); ++ cit) {
-            cit->process(cycleContext);
+            cit->template process<isPlastic>(cycleContext);
             ++ numEventsProcessed;
         }
 
-        processBatch(cycleContext, buffers...);
+        processBatch<isPlastic>(cycleContext, buffers...);
     }
 
     template<typename T, typename... Args>
@@ -83,7 +144,21 @@ private:
     };
 
     BatchedRingBuffer<TransmissionEvent> transmissionEventBuffer;
-    std::vector<FiringThresholdEvalEvent> firingThresholdEvalBuffer;
+    std::vector<Neuron*> firingThresholdEvalCandidates;
+
+    // only filled when tracking the event order, in step with the events and candidates
+    bool isTrackingEventOrder;
+    BatchedRingBuffer<EventOrderKey> eventOrderKeyBuffer;
+    EventOrderKey currentEventOrderKey;
+    SizeType numImmediateEventsInCycle;
+    std::vector<EventOrderKey> candidateEventOrderKeys;
+    std::vector<EventOrderKey> spikeEventOrderKeys;
+
+    std::vector<ValueType> candidateVoltages;
+    std::vector<ValueType> candidateThresholdVoltages;
+    std::vector<char> candidateIsAboveThreshold;
+    FiringThresholdEvalStats lastCycleFiringThresholdEvalStats;
+    FiringThresholdEvalStats totalFiringThresholdEvalStats;
     using QueueType = std::priority_queue<CommonEventWithTargetTime, std::vector<CommonEventWithTargetTime>, std::greater<CommonEventWithTargetTime>>;
     QueueType commonEventsQueue;
     ValueType frequency;
@@ -0,0 +1,189 @@
+#include "FiringRateMonitor.hpp"
+#include "CycleOutputBuffer.hpp"
+#include <neuro/Population.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace soft_npu {
+
+FiringRateMonitor::FiringRateMonitor() noexcept :
+        binDuration(0),
+        binNumCycles(0),
+        numBins(0),
+        numCyclesInCurrentBin(0),
+        numCompletedBins(0),
+        nextBinIndex(0) {
+}
+
+FiringRateMonitor::FiringRateMonitor(
+        TimeType dt,
+        SizeType binNumCycles,
+        SizeType numBins,
+        const std::vector<NeuronGroup>& neuronGroups) :
+        binDuration(dt * binNumCycles),
+        binNumCycles(binNumCycles),
+        numBins(numBins),
+        numCyclesInCurrentBin(0),
+        numCompletedBins(0),
+        nextBinIndex(0) {
+
+    if (binNumCycles == 0 || numBins == 0) {
+        throw std::runtime_error("Firing rate monitor requires at least one bin of at least one cycle");
+    }
+
+    SizeType numNeurons = 0;
+    for (const auto& neuronGroup : neuronGroups) {
+        for (auto neuronId : neuronGroup.neuronIds) {
+            numNeurons = std::max(numNeurons, neuronId + 1);
+        }
+    }
+
+    std::vector<std::vector<SizeType>> groupIndicesByNeuronId(numNeurons);
+
+    for (SizeType groupIndex = 0; groupIndex < neuronGroups.size(); ++groupIndex) {
+        neuronGroupNames.push_back(neuronGroups[groupIndex].name);
+        neuronGroupSizes.push_back(neuronGroups[groupIndex].neuronIds.size());
+
+        for (auto neuronId : neuronGroups[groupIndex].neuronIds) {
+            groupIndicesByNeuronId[neuronId].push_back(groupIndex);
+        }
+    }
+
+    groupIndexOffsets.push_back(0);
+
+    for (const auto& neuronGroupIndices : groupIndicesByNeuronId) {
+        groupIndices.insert(groupIndices.end(), neuronGroupIndices.cbegin(), neuronGroupIndices.cend());
+        groupIndexOffsets.push_back(groupIndices.size());
+    }
+
+    currentBinCounts.resize(neuronGroups.size());
+    windowCounts.resize(neuronGroups.size());
+    binCountsBySeries.resize(neuronGroups.size(), std::vector<SizeType>(numBins));
+}
+
+std::vector<NeuronGroup> FiringRateMonitor::makeStandardNeuronGroups(const Population& population) {
+    NeuronGroup excitatory{"excitatory", {}};
+    NeuronGroup inhibitory{"inhibitory", {}};
+
+    for (auto it = population.cbeginNeurons(); it != population.cendNeurons(); ++it) {
+        auto& neuronGroup = (*it)->getNeuronParams()->isInhibitory ? inhibitory : excitatory;
+        neuronGroup.neuronIds.push_back((*it)->getNeuronId());
+    }
+
+    auto makeSortedGroup = [](std::string name, const std::unordered_set<SizeType>& neuronIds) {
+        NeuronGroup neuronGroup{std::move(name), {neuronIds.cbegin(), neuronIds.cend()}};
+        std::sort(neuronGroup.neuronIds.begin(), neuronGroup.neuronIds.end());
+        return neuronGroup;
+    };
+
+    return {
+        std::move(excitatory),
+        std::move(inhibitory),
+        makeSortedGroup("sensory", population.getSensoryNeuronIds()),
+        makeSortedGroup("motor", population.getMotorNeuronIds())
+    };
+}
+
+void FiringRateMonitor::recordCycle(const CycleOutputBuffer& cycleOutputBuffer) {
+    for (auto neuronId : cycleOutputBuffer.getSpikingNeuronIds()) {
+        if (neuronId + 1 < groupIndexOffsets.size()) {
+            for (auto i = groupIndexOffsets[neuronId]; i < groupIndexOffsets[neuronId + 1]; ++i) {
+                ++ currentBinCounts[groupIndices[i]];
+            }
+        }
+    }
+
+    auto numNeuronGroups = neuronGroupNames.size();
+
+    for (
+            auto it = cycleOutputBuffer.cbeginSpikingChannelIds();
+            it != cycleOutputBuffer.cendSpikingChannelIds();
+            ++it) {
+
+        if (*it >= getNumOutputChannels()) {
+            addOutputChannels(*it + 1);
+        }
+
+        ++ currentBinCounts[numNeuronGroups + *it];
+    }
+
+    if (++ numCyclesInCurrentBin == binNumCycles) {
+        completeBin();
+    }
+}
+
+void FiringRateMonitor::completeBin() noexcept {
+    for (SizeType series = 0; series < currentBinCounts.size(); ++series) {
+        auto& evictedBinCount = binCountsBySeries[series][nextBinIndex];
+        windowCounts[series] = windowCounts[series] + currentBinCounts[series] - evictedBinCount;
+        evictedBinCount = currentBinCounts[series];
+        currentBinCounts[series] = 0;
+    }
+
+    nextBinIndex = nextBinIndex + 1 == numBins ? 0 : nextBinIndex + 1;
+    numCompletedBins = std::min(numCompletedBins + 1, numBins);
+    numCyclesInCurrentBin = 0;
+}
+
+void FiringRateMonitor::addOutputChannels(SizeType numOutputChannels) {
+    auto numSeries = neuronGroupNames.size() + numOutputChannels;
+    currentBinCounts.resize(numSeries);
+    windowCounts.resize(numSeries);
+    binCountsBySeries.resize(numSeries, std::vector<SizeType>(numBins));
+}
+
+SizeType FiringRateMonitor::getNumNeuronGroups() const noexcept {
+    return neuronGroupNames.size();
+}
+
+const std::string& FiringRateMonitor::getNeuronGroupName(SizeType groupIndex) const {
+    return neuronGroupNames.at(groupIndex);
+}
+
+SizeType FiringRateMonitor::getNeuronGroupIndex(const std::string& groupName) const {
+    auto it = std::find(neuronGroupNames.cbegin(), neuronGroupNames.cend(), groupName);
+
+    if (it == neuronGroupNames.cend()) {
+        throw std::runtime_error("Unknown neuron group: " + groupName);
+    }
+
+    return it - neuronGroupNames.cbegin();
+}
+
+double FiringRateMonitor::getFiringRate(SizeType groupIndex) const {
+    auto windowDuration = getWindowDuration();
+    auto groupSize = neuronGroupSizes.at(groupIndex);
+
+    return windowDuration == 0 || groupSize == 0 ? 0 : windowCounts[groupIndex] / windowDuration / groupSize;
+}
+
+double FiringRateMonitor::getFiringRate(const std::string& groupName) const {
+    return getFiringRate(getNeuronGroupIndex(groupName));
+}
+
+double FiringRateMonitor::getMaxFiringRate() const noexcept {
+    double maxFiringRate = 0;
+
+    for (SizeType groupIndex = 0; groupIndex < neuronGroupNames.size(); ++groupIndex) {
+        maxFiringRate = std::max(maxFiringRate, getFiringRate(groupIndex));
+    }
+
+    return maxFiringRate;
+}
+
+double FiringRateMonitor::getOutputChannelRate(SizeType channelId) const noexcept {
+    auto windowDuration = getWindowDuration();
+
+    return windowDuration == 0 || channelId >= getNumOutputChannels() ?
+        0 : windowCounts[neuronGroupNames.size() + channelId] / windowDuration;
+}
+
+SizeType FiringRateMonitor::getNumOutputChannels() const noexcept {
+    return currentBinCounts.size() - neuronGroupNames.size();
+}
+
+TimeType FiringRateMonitor::getWindowDuration() const noexcept {
+    return numCompletedBins * binDuration;
+}
+
+}
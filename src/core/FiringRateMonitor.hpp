@@ -0,0 +1,82 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <string>
+#include <vector>
+
+namespace soft_npu {
+
+class CycleOutputBuffer;
+class Population;
+
+struct NeuronGroup {
+    std::string name;
+    std::vector<SizeType> neuronIds;
+};
+
+// Sliding window firing rates of neuron groups and output channels, maintained online from the spikes of each cycle.
+// Spikes are counted into bins of binNumCycles cycles and the window spans the last numBins completed bins, so the
+// rates lag by at most one bin. An update costs O(1) per spike and group membership, plus O(number of groups and
+// output channels) per completed bin. A default constructed monitor is disabled.
+class FiringRateMonitor {
+public:
+    FiringRateMonitor() noexcept;
+    FiringRateMonitor(TimeType dt, SizeType binNumCycles, SizeType numBins, const std::vector<NeuronGroup>& neuronGroups);
+
+    // excitatory, inhibitory, sensory (targets of input channels) and motor neurons
+    static std::vector<NeuronGroup> makeStandardNeuronGroups(const Population& population);
+
+    bool isEnabled() const noexcept {
+        return numBins > 0;
+    }
+
+    void onCycleEnd(const CycleOutputBuffer& cycleOutputBuffer) {
+        if (isEnabled()) {
+            recordCycle(cycleOutputBuffer);
+        }
+    }
+
+    SizeType getNumNeuronGroups() const noexcept;
+    const std::string& getNeuronGroupName(SizeType groupIndex) const;
+    SizeType getNeuronGroupIndex(const std::string& groupName) const;
+
+    // mean spikes per neuron and second within the window, 0 until the first bin is completed
+    double getFiringRate(SizeType groupIndex) const;
+    double getFiringRate(const std::string& groupName) const;
+    double getMaxFiringRate() const noexcept;
+
+    // spikes per second of an output channel within the window
+    double getOutputChannelRate(SizeType channelId) const noexcept;
+
+    // one more than the highest output channel id seen so far
+    SizeType getNumOutputChannels() const noexcept;
+
+    // covered by the completed bins, grows up to the full window length
+    TimeType getWindowDuration() const noexcept;
+
+private:
+    void recordCycle(const CycleOutputBuffer& cycleOutputBuffer);
+    void completeBin() noexcept;
+    void addOutputChannels(SizeType numOutputChannels);
+
+    TimeType binDuration;
+    SizeType binNumCycles;
+    SizeType numBins;
+    std::vector<std::string> neuronGroupNames;
+    std::vector<SizeType> neuronGroupSizes;
+
+    // the groups of neuron i are groupIndices[groupIndexOffsets[i]] to groupIndices[groupIndexOffsets[i + 1] - 1]
+    std::vector<SizeType> groupIndexOffsets;
+    std::vector<SizeType> groupIndices;
+
+    // one series per neuron group, followed by one per output channel
+    std::vector<SizeType> currentBinCounts;
+    std::vector<SizeType> windowCounts;
+    std::vector<std::vector<SizeType>> binCountsBySeries;
+
+    SizeType numCyclesInCurrentBin;
+    SizeType numCompletedBins;
+    SizeType nextBinIndex;
+};
+
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <Aliases.hpp>
+
+namespace soft_npu {
+
+struct FiringThresholdEvalStats {
+    SizeType numCandidates = 0;
+    SizeType numSpikes = 0;
+};
+
+}
@@ -0,0 +1,161 @@
+#include <util/CounterBasedRandomEngine.hpp>
+#include "NoiseSchedule.hpp"
+
+namespace soft_npu {
+
+void drawNoiseCycle(
+        uint64_t seed,
+        SizeType cycleId,
+        SizeType numNeurons,
+        std::poisson_distribution<SizeType>& poissonDistribution,
+        std::vector<SizeType>& neuronIndices) {
+
+    CounterBasedRandomEngine randomEngine(
+            seed,
+            CounterBasedRandomEngine::Subsystem::nonCoherentStimulation,
+            0,
+            static_cast<uint32_t>(cycleId));
+
+    poissonDistribution.reset();
+
+    auto numSpikingNeurons = std::min(
+            static_cast<SizeType>(poissonDistribution(randomEngine)),
+            numNeurons);
+
+    for (SizeType i = 0; i < numSpikingNeurons; ++i) {
+        neuronIndices.push_back(std::uniform_int_distribution<SizeType>(0, numNeurons - 1)(randomEngine));
+    }
+}
+
+NoiseSchedule::NoiseSchedule(
+        uint64_t seed,
+        SizeType numNeurons,
+        SizeType numCyclesPerBlock,
+        SizeType numBlocks) :
+        seed(seed),
+        numNeurons(numNeurons),
+        numCyclesPerBlock(numCyclesPerBlock),
+        blocks(numBlocks),
+        numBlocksProduced(0),
+        numBlocksConsumed(0),
+        isRunning(false),
+        isConsumerWaiting(false),
+        isProducerWaiting(false),
+        hasAcquiredBlock(false) {
+}
+
+NoiseSchedule::~NoiseSchedule() {
+    stop();
+}
+
+void NoiseSchedule::start(SizeType firstCycleId, ValueType poissonDistLambda) {
+    stop();
+
+    numBlocksProduced = 0;
+    numBlocksConsumed = 0;
+    isConsumerWaiting = false;
+    isProducerWaiting = false;
+    hasAcquiredBlock = false;
+    isRunning = true;
+
+    producerThread = std::thread(&NoiseSchedule::produce, this, firstCycleId, poissonDistLambda);
+}
+
+void NoiseSchedule::stop() noexcept {
+    isRunning = false;
+
+    {
+        // the producer either sees isRunning cleared before it waits or is waiting already
+        std::lock_guard<std::mutex> lock(mutex);
+    }
+
+    blockConsumedCondition.notify_one();
+
+    if (producerThread.joinable()) {
+        producerThread.join();
+    }
+}
+
+// The flag of the waiting side and the counter of the other side are stored and loaded sequentially consistently,
+// so either the waiting side sees the new counter value when it evaluates its condition, or the other side sees the
+// flag and notifies after the waiting side has released the mutex in its wait.
+const NoiseSchedule::Block& NoiseSchedule::acquireBlockContaining(SizeType cycleId) {
+    while (true) {
+        if (hasAcquiredBlock) {
+            auto blockIndex = numBlocksConsumed.load(std::memory_order_relaxed);
+            const auto& block = blocks[blockIndex % blocks.size()];
+
+            if (cycleId < block.firstCycleId + numCyclesPerBlock) {
+                return block;
+            }
+
+            numBlocksConsumed = blockIndex + 1;
+            hasAcquiredBlock = false;
+
+            if (isProducerWaiting) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                }
+
+                blockConsumedCondition.notify_one();
+            }
+        }
+
+        if (numBlocksProduced.load(std::memory_order_acquire) == numBlocksConsumed.load(std::memory_order_relaxed)) {
+            std::unique_lock<std::mutex> lock(mutex);
+            isConsumerWaiting = true;
+            blockProducedCondition.wait(lock, [this] { return numBlocksProduced != numBlocksConsumed; });
+            isConsumerWaiting = false;
+        }
+
+        hasAcquiredBlock = true;
+    }
+}
+
+void NoiseSchedule::produce(SizeType firstCycleId, ValueType poissonDistLambda) {
+    std::poisson_distribution<SizeType> poissonDistribution(poissonDistLambda);
+    SizeType blockIndex = 0;
+    SizeType nextCycleId = firstCycleId;
+
+    auto canProduce = [this, &blockIndex] {
+        return !isRunning || blockIndex - numBlocksConsumed < blocks.size();
+    };
+
+    while (true) {
+        if (!canProduce()) {
+            std::unique_lock<std::mutex> lock(mutex);
+            isProducerWaiting = true;
+            blockConsumedCondition.wait(lock, canProduce);
+            isProducerWaiting = false;
+        }
+
+        if (!isRunning) {
+            return;
+        }
+
+        // the slot is neither readable by the consumer nor written by anyone else until the block is published
+        auto& block = blocks[blockIndex % blocks.size()];
+        block.firstCycleId = nextCycleId;
+        block.cycleBeginOffsets.clear();
+        block.neuronIndices.clear();
+
+        for (SizeType i = 0; i < numCyclesPerBlock; ++i) {
+            block.cycleBeginOffsets.push_back(block.neuronIndices.size());
+            drawNoiseCycle(seed, nextCycleId++, numNeurons, poissonDistribution, block.neuronIndices);
+        }
+
+        block.cycleBeginOffsets.push_back(block.neuronIndices.size());
+
+        numBlocksProduced = ++ blockIndex;
+
+        if (isConsumerWaiting) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+            }
+
+            blockProducedCondition.notify_one();
+        }
+    }
+}
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+
+namespace soft_npu {
+
+// draws the indices of the neurons stimulated in the given cycle; depends only on the arguments
+void drawNoiseCycle(
+        uint64_t seed,
+        SizeType cycleId,
+        SizeType numNeurons,
+        std::poisson_distribution<SizeType>& poissonDistribution,
+        std::vector<SizeType>& neuronIndices);
+
+// Generates the noise schedule ahead of time on a background thread. Blocks of consecutive cycles are handed
+// over through a lock-free single-producer single-consumer ring, and cycles must be consumed in ascending order.
+// Either side blocks on a condition variable only while the ring is empty or full; the other side takes the lock
+// to notify it only if it announced that it waits.
+class NoiseSchedule : private boost::noncopyable {
+public:
+    NoiseSchedule(
+            uint64_t seed,
+            SizeType numNeurons,
+            SizeType numCyclesPerBlock,
+            SizeType numBlocks);
+
+    ~NoiseSchedule();
+
+    void start(SizeType firstCycleId, ValueType poissonDistLambda);
+    void stop() noexcept;
+
+    template<typename F>
+    void forEachNeuronIndex(SizeType cycleId, F f) {
+        const auto& block = acquireBlockContaining(cycleId);
+        auto offset = cycleId - block.firstCycleId;
+
+        for (auto i = block.cycleBeginOffsets[offset]; i < block.cycleBeginOffsets[offset + 1]; ++i) {
+            f(block.neuronIndices[i]);
+        }
+    }
+
+private:
+    struct Block {
+        SizeType firstCycleId;
+        std::vector<SizeType> cycleBeginOffsets;
+        std::vector<SizeType> neuronIndices;
+    };
+
+    const Block& acquireBlockContaining(SizeType cycleId);
+    void produce(SizeType firstCycleId, ValueType poissonDistLambda);
+
+    const uint64_t seed;
+    const SizeType numNeurons;
+    const SizeType numCyclesPerBlock;
+    std::vector<Block> blocks;
+
+    // written by the producer and the consumer only, respectively
+    std::atomic<SizeType> numBlocksProduced;
+    std::atomic<SizeType> numBlocksConsumed;
+    // cleared by stop
+    std::atomic<bool> isRunning;
+
+    // set under the mutex by a side about to wait on its condition
+    std::atomic<bool> isConsumerWaiting;
+    std::atomic<bool> isProducerWaiting;
+    std::mutex mutex;
+    std::condition_variable blockProducedCondition;
+    std::condition_variable blockConsumedCondition;
+
+    bool hasAcquiredBlock;
+    std::thread producerThread;
+};
+
+}
@@ -7,14 +7,14 @@
 
 namespace soft_npu {
 
-std::vector<std::reference_wrapper<Neuron>> getNeuronsToStimulate(Population& population) {
+std::vector<Neuron*> getNeuronsToStimulate(Population& population) {
 
-    std::vector<std::reference_wrapper<Neuron>> rv;
+    std::vector<Neuron*> rv;
     std::transform(
             population.cbeginNeurons(),
             population.cendNeurons(),
             std::back_inserter(rv), [](const auto& neuron) {
-                return std::ref(*neuron);
+                return neuron.get();
             });
     return rv;
 }
@@ -25,44 +25,51 @@ ValueType getPoissonDistLambda(SizeType numNeuronsToStimulate, TimeType dt, Valu
 
 NonCoherentStimulator::NonCoherentStimulator(
         const ParamsType& params,
-        RandomEngineType& randomEngine,
         Population& population,
         TimeType dt) :
-        randomEngine(randomEngine),
+        seed(params["simulation"]["seed"]),
         neuronsToStimulate(getNeuronsToStimulate(population)),
         poissonDistribution(getPoissonDistLambda(neuronsToStimulate.size(), dt,
        static_cast<ValueType>(params["nonCoherentStimulator"]["rate"]))),
         dt(dt),
-
+        nextCycleId(0),
         epsp(params["nonCoherentStimulator"]["epsp"])
         {
+
+    auto it = params["nonCoherentStimulator"].find("precomputeSchedule");
+    if (it != params["nonCoherentStimulator"].end() && it->get<bool>() && !neuronsToStimulate.empty()) {
+        noiseSchedule = std::make_unique<NoiseSchedule>(
+                seed, neuronsToStimulate.size(), scheduleNumCyclesPerBlock, scheduleNumBlocks);
+        noiseSchedule->start(nextCycleId, poissonDistribution.mean());
+    }
 }
 
 void NonCoherentStimulator::processCycle(const CycleContext& ctx) {
 
-    if (!neuronsToStimulate.empty()) {
-        auto numSpikingNeurons = std::min(
-                static_cast<SizeType>(poissonDistribution(randomEngine)),
-                static_cast<SizeType>(neuronsToStimulate.size()));
+    nextCycleId = ctx.cycleId + 1;
 
-        std::vector<std::reference_wrapper<Neuron>> selectedNeurons;
-        selectedNeurons.reserve(numSpikingNeurons);
+    if (noiseSchedule) {
+        noiseSchedule->forEachNeuronIndex(ctx.cycleId, [this, &ctx](SizeType neuronIdx) {
+            ctx.staticContext.eventProcessor.pushImmediateTransmissionEvent(epsp, neuronsToStimulate[neuronIdx]);
+        });
+    } else if (!neuronsToStimulate.empty()) {
+        selectedNeuronIndices.clear();
+        drawNoiseCycle(seed, ctx.cycleId, neuronsToStimulate.size(), poissonDistribution, selectedNeuronIndices);
 
-        for (SizeType i = 0; i < numSpikingNeurons; ++i) {
-            SizeType neuronIdx = std::uniform_int_distribution<SizeType>(0, neuronsToStimulate.size() - 1)(randomEngine);
-            selectedNeurons.push_back(neuronsToStimulate[neuronIdx]);
-        }
-
-        for (auto neuron : selectedNeurons) {
-            ctx.staticContext.eventProcessor.pushImmediateTransmissionEvent(epsp, neuron);
+        for (auto neuronIdx : selectedNeuronIndices) {
+            ctx.staticContext.eventProcessor.pushImmediateTransmissionEvent(epsp, neuronsToStimulate[neuronIdx]);
         }
     }
 }
 
-void NonCoherentStimulator::setRate(ValueType rate) noexcept {
+void NonCoherentStimulator::setRate(ValueType rate) {
     typename std::poisson_distribution<SizeType>::param_type param(
         getPoissonDistLambda(neuronsToStimulate.size(), dt, rate));
     poissonDistribution.param(param);
+
+    if (noiseSchedule) {
+        noiseSchedule->start(nextCycleId, poissonDistribution.mean());
+    }
 }
 
 }
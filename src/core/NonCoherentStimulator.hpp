@@ -3,6 +3,8 @@
 #include <Aliases.hpp>
 #include <vector>
 #include <random>
+#include <memory>
+#include "NoiseSchedule.hpp"
 
 namespace soft_npu {
 
@@ -15,19 +17,25 @@ public:
 
     NonCoherentStimulator(
             const ParamsType& params,
-            RandomEngineType& randomEngine,
             Population& population,
             TimeType dt);
 
     void processCycle(const CycleContext&);
-    void setRate(ValueType rate) noexcept;
+    void setRate(ValueType rate);
 
 private:
-    RandomEngineType& randomEngine;
-    std::vector<std::reference_wrapper<Neuron>> neuronsToStimulate;
+    static constexpr SizeType scheduleNumCyclesPerBlock = 256;
+    static constexpr SizeType scheduleNumBlocks = 8;
+
+    uint64_t seed;
+    // indexed by neuron id, null for the neurons of other partitions
+    std::vector<Neuron*> neuronsToStimulate;
     std::poisson_distribution<SizeType> poissonDistribution;
+    std::vector<SizeType> selectedNeuronIndices;
     TimeType dt;
+    SizeType nextCycleId;
     ValueType epsp;
+    std::unique_ptr<NoiseSchedule> noiseSchedule;
 };
 
 }
@@ -0,0 +1,188 @@
+#include "PartitionSynchronizer.hpp"
+#include "CycleController.hpp"
+#include "EventProcessor.hpp"
+#include "PopulationPartition.hpp"
+#include "StaticContext.hpp"
+#include "SynapticTransmissionStats.hpp"
+#include <neuro/Population.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace soft_npu {
+
+PartitionSynchronizer::PartitionSynchronizer(
+        const PopulationPartition& partition,
+        SpikeExchange& spikeExchange,
+        const CycleController& controller,
+        SynapticTransmissionStats& synapticTransmissionStats,
+        TimeType lookAheadWindow) :
+        partition(partition),
+        spikeExchange(spikeExchange),
+        controller(controller),
+        synapticTransmissionStats(synapticTransmissionStats),
+        dt(controller.getTimeIncrement()),
+        maxEpochNumCycles(0),
+        epochBeginCycleId(0),
+        epochEndCycleId(0),
+        nextCycleId(0),
+        exchangedSpikesByPartitionId(partition.getNumPartitions()) {
+
+    // without synapses between partitions, epochs span the look-ahead window, which bounds the spikes kept per epoch
+    auto minRemoteConductionDelay = partition.getMinRemoteConductionDelay();
+    auto maxNumCycles = controller.getNumCycles(lookAheadWindow);
+
+    if (!std::isinf(minRemoteConductionDelay)) {
+        maxNumCycles = std::min(maxNumCycles, controller.getNumCycles(minRemoteConductionDelay));
+    }
+
+    maxEpochNumCycles = spikeExchange.getMinimum(partition.getPartitionId(), maxNumCycles);
+}
+
+SizeType PartitionSynchronizer::getEpochEndCycleId(SizeType epochBeginCycleId) const noexcept {
+    auto maxEpochEndCycleId = epochBeginCycleId + maxEpochNumCycles;
+
+    for (auto cycleId = epochBeginCycleId; cycleId < maxEpochEndCycleId; ++cycleId) {
+        if (controller.isDopamineReleaseDue(cycleId)) {
+            return cycleId + 1;
+        }
+    }
+
+    return maxEpochEndCycleId;
+}
+
+void PartitionSynchronizer::onCycleEvents(const CycleContext& ctx) {
+    auto& eventProcessor = ctx.staticContext.eventProcessor;
+    const auto& spikingNeuronIds = ctx.staticContext.cycleOutputBuffer.getSpikingNeuronIds();
+    const auto& spikeEventOrderKeys = eventProcessor.getSpikeEventOrderKeys();
+
+    // the dopamine releases of earlier cycles are known once the epoch has begun
+    if (ctx.cycleId == epochBeginCycleId) {
+        epochEndCycleId = getEpochEndCycleId(epochBeginCycleId);
+    }
+
+    nextCycleId = ctx.cycleId + 1;
+
+    for (SizeType localRank = 0; localRank < spikingNeuronIds.size(); ++localRank) {
+        pushSynapticTransmissionEvents(&eventProcessor, spikingNeuronIds[localRank], ctx.cycleId, localRank, true);
+        epochSpikes.push_back({spikingNeuronIds[localRank], ctx.cycleId, spikeEventOrderKeys[localRank]});
+    }
+
+    if (nextCycleId == epochEndCycleId) {
+        exchangeEpochSpikes(&eventProcessor);
+    }
+}
+
+void PartitionSynchronizer::finish() {
+    if (nextCycleId > epochBeginCycleId) {
+        exchangeEpochSpikes(nullptr);
+    }
+}
+
+void PartitionSynchronizer::exchangeEpochSpikes(EventProcessor* eventProcessor) {
+    auto numPartitions = partition.getNumPartitions();
+
+    for (auto& exchangedSpikes : exchangedSpikesByPartitionId) {
+        exchangedSpikes.clear();
+    }
+
+    spikeExchange.exchange(partition.getPartitionId(), epochSpikes, [this](SizeType partitionId, const ExchangedSpike& spike) {
+        exchangedSpikesByPartitionId[partitionId].push_back(spike);
+    });
+
+    epochSpikes.clear();
+
+    auto numEpochCycles = nextCycleId - epochBeginCycleId;
+    globalRanks.resize(std::max(globalRanks.size(), numEpochCycles));
+    std::vector<SizeType> positions(numPartitions);
+
+    for (SizeType epochCycle = 0; epochCycle < numEpochCycles; ++epochCycle) {
+        auto cycleId = epochBeginCycleId + epochCycle;
+        auto& cycleGlobalRanks = globalRanks[epochCycle];
+        cycleGlobalRanks.resize(numPartitions);
+        cycleSpikes.clear();
+
+        for (SizeType partitionId = 0; partitionId < numPartitions; ++partitionId) {
+            const auto& exchangedSpikes = exchangedSpikesByPartitionId[partitionId];
+            auto& position = positions[partitionId];
+            cycleGlobalRanks[partitionId].clear();
+
+            for (; position < exchangedSpikes.size() && exchangedSpikes[position].cycleId == cycleId; ++position) {
+                auto eventOrderKey = exchangedSpikes[position].eventOrderKey;
+
+                // events from spikes of this epoch were pushed by the partition of the spiking neuron, keyed by the
+                // rank of the spike among its local spikes
+                if (!eventOrderKey.isImmediate() && eventOrderKey.spikeCycleId >= epochBeginCycleId) {
+                    eventOrderKey.spikeRank =
+                            globalRanks[eventOrderKey.spikeCycleId - epochBeginCycleId][partitionId][eventOrderKey.spikeRank];
+                }
+
+                cycleSpikes.push_back({
+                    eventOrderKey, partitionId, cycleGlobalRanks[partitionId].size(), exchangedSpikes[position].neuronId});
+                cycleGlobalRanks[partitionId].push_back(0);
+            }
+        }
+
+        std::sort(cycleSpikes.begin(), cycleSpikes.end(), [](const RankedSpike& lhs, const RankedSpike& rhs) {
+            return lhs.eventOrderKey < rhs.eventOrderKey;
+        });
+
+        for (SizeType spikeRank = 0; spikeRank < cycleSpikes.size(); ++spikeRank) {
+            const auto& rankedSpike = cycleSpikes[spikeRank];
+            cycleGlobalRanks[rankedSpike.partitionId][rankedSpike.localRank] = spikeRank;
+
+            if (partition.getPartitionId() == 0) {
+                spikes.emplace_back(dt * cycleId, rankedSpike.neuronId);
+            }
+
+            if (rankedSpike.partitionId == partition.getPartitionId()) {
+                partition.getPopulation().projectNeuronSpike(outputBuffer, rankedSpike.neuronId);
+
+                std::for_each(outputBuffer.cbeginSpikingChannelIds(), outputBuffer.cendSpikingChannelIds(),
+                        [this, cycleId, spikeRank](SizeType channelId) {
+                    outputChannelSpikes.push_back({cycleId, spikeRank, channelId});
+                });
+
+                outputBuffer.reset();
+            }
+
+            pushSynapticTransmissionEvents(eventProcessor, rankedSpike.neuronId, cycleId, spikeRank, false);
+        }
+    }
+
+    epochBeginCycleId = nextCycleId;
+}
+
+void PartitionSynchronizer::pushSynapticTransmissionEvents(
+        EventProcessor* eventProcessor,
+        SizeType neuronId,
+        SizeType cycleId,
+        SizeType spikeRank,
+        bool isWithinEpoch) {
+
+    ValueType signum = partition.isInhibitory(neuronId) ? -1.0 : 1.0;
+    SizeType numTransmissions = 0;
+
+    for (const auto& inboundSynapse : partition.getInboundSynapses(neuronId)) {
+        auto synapse = inboundSynapse.synapse;
+        auto targetCycleId = cycleId + controller.getNumCycles(synapse->conductionDelay);
+
+        if ((targetCycleId < epochEndCycleId) != isWithinEpoch) {
+            continue;
+        }
+
+        if (eventProcessor != nullptr) {
+            eventProcessor->pushOrderedSynapticTransmissionEvent(
+                    targetCycleId - nextCycleId,
+                    synapse->weight * signum,
+                    synapse,
+                    *synapse->postSynapticNeuron,
+                    {cycleId, spikeRank, inboundSynapse.synapseIndex});
+        }
+
+        ++ numTransmissions;
+    }
+
+    synapticTransmissionStats.increaseTransmissionCount(numTransmissions);
+}
+
+}
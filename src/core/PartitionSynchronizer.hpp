@@ -0,0 +1,95 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include "CycleOutputBuffer.hpp"
+#include "NeuronSpikeInfo.hpp"
+#include "SpikeExchange.hpp"
+#include <boost/core/noncopyable.hpp>
+#include <vector>
+
+namespace soft_npu {
+
+class CycleController;
+class EventProcessor;
+class PopulationPartition;
+class SynapticTransmissionStats;
+struct CycleContext;
+
+// Delivers the synaptic transmission events of a partition in the order in which the single process simulation of the
+// full population processes them, which makes partitioned runs bit-identical to it, plasticity included.
+//
+// Spikes are exchanged at the end of each epoch. An epoch is at most as long as the shortest conduction delay between
+// partitions, so that the spikes of remote neurons cannot reach local neurons within the epoch they were fired in, and
+// it ends with the first cycle that releases dopamine, so that all events are pushed with the weights their spikes saw.
+// Within an epoch, events from local spikes to later cycles of the epoch are pushed as the spikes occur, keyed by the
+// rank of the spike among the local spikes of its cycle. At the end of the epoch, the spikes of all partitions are
+// ranked per cycle by the key of the event that made their neuron a threshold evaluation candidate, which is the
+// order in which the single process fires them, and the events of all spikes to later epochs are pushed in that order.
+class PartitionSynchronizer : private boost::noncopyable {
+public:
+    // the output channel spikes of a local neuron spike, ranked among all spikes of its cycle
+    struct OutputChannelSpike {
+        SizeType cycleId;
+        SizeType spikeRank;
+        SizeType channelId;
+    };
+
+    PartitionSynchronizer(
+            const PopulationPartition& partition,
+            SpikeExchange& spikeExchange,
+            const CycleController& controller,
+            SynapticTransmissionStats& synapticTransmissionStats,
+            TimeType lookAheadWindow);
+
+    void onCycleEvents(const CycleContext& ctx);
+
+    // exchanges the spikes of the last, incomplete epoch
+    void finish();
+
+    // of all partitions, in single process order; only recorded by the first partition
+    const std::vector<NeuronSpikeInfo>& getSpikes() const noexcept {
+        return spikes;
+    }
+
+    const std::vector<OutputChannelSpike>& getOutputChannelSpikes() const noexcept {
+        return outputChannelSpikes;
+    }
+
+private:
+    struct RankedSpike {
+        EventOrderKey eventOrderKey;
+        SizeType partitionId;
+        SizeType localRank;
+        SizeType neuronId;
+    };
+
+    SizeType getEpochEndCycleId(SizeType epochBeginCycleId) const noexcept;
+
+    // without an event processor, the events are only counted
+    void exchangeEpochSpikes(EventProcessor* eventProcessor);
+
+    void pushSynapticTransmissionEvents(
+            EventProcessor* eventProcessor, SizeType neuronId, SizeType cycleId, SizeType spikeRank, bool isWithinEpoch);
+
+    const PopulationPartition& partition;
+    SpikeExchange& spikeExchange;
+    const CycleController& controller;
+    SynapticTransmissionStats& synapticTransmissionStats;
+    const TimeType dt;
+    SizeType maxEpochNumCycles;
+    SizeType epochBeginCycleId;
+    SizeType epochEndCycleId;
+    SizeType nextCycleId;
+    std::vector<ExchangedSpike> epochSpikes;
+
+    // indexed by cycle within the epoch, partition and rank among the local spikes of the cycle
+    std::vector<std::vector<std::vector<SizeType>>> globalRanks;
+
+    std::vector<std::vector<ExchangedSpike>> exchangedSpikesByPartitionId;
+    std::vector<RankedSpike> cycleSpikes;
+    CycleOutputBuffer outputBuffer;
+    std::vector<NeuronSpikeInfo> spikes;
+    std::vector<OutputChannelSpike> outputChannelSpikes;
+};
+
+}
@@ -0,0 +1,135 @@
+#include "PerfCounters.hpp"
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace soft_npu {
+
+PerfCounts& PerfCounts::operator+=(const PerfCounts& rhs) noexcept {
+    cycles += rhs.cycles;
+    instructions += rhs.instructions;
+    l1dReadMisses += rhs.l1dReadMisses;
+    llcReadMisses += rhs.llcReadMisses;
+    branchMisses += rhs.branchMisses;
+    timeEnabled += rhs.timeEnabled;
+    timeRunning += rhs.timeRunning;
+    return *this;
+}
+
+PerfCounts PerfCounts::operator-(const PerfCounts& rhs) const noexcept {
+    PerfCounts difference;
+    difference.cycles = cycles - rhs.cycles;
+    difference.instructions = instructions - rhs.instructions;
+    difference.l1dReadMisses = l1dReadMisses - rhs.l1dReadMisses;
+    difference.llcReadMisses = llcReadMisses - rhs.llcReadMisses;
+    difference.branchMisses = branchMisses - rhs.branchMisses;
+    difference.timeEnabled = timeEnabled - rhs.timeEnabled;
+    difference.timeRunning = timeRunning - rhs.timeRunning;
+    return difference;
+}
+
+PerfCounts PerfCounts::getScaled() const noexcept {
+    if (isUnavailable() || timeRunning >= timeEnabled) {
+        return *this;
+    }
+
+    auto scale = static_cast<double>(timeEnabled) / timeRunning;
+    auto scaleCount = [scale](uint64_t count) {
+        return static_cast<uint64_t>(count * scale + 0.5);
+    };
+
+    PerfCounts scaled = *this;
+    scaled.cycles = scaleCount(cycles);
+    scaled.instructions = scaleCount(instructions);
+    scaled.l1dReadMisses = scaleCount(l1dReadMisses);
+    scaled.llcReadMisses = scaleCount(llcReadMisses);
+    scaled.branchMisses = scaleCount(branchMisses);
+    return scaled;
+}
+
+static constexpr uint64_t getCacheReadMissConfig(uint64_t cacheId) {
+    return cacheId | (PERF_COUNT_HW_CACHE_OP_READ << 8u) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u);
+}
+
+// in the order of the PerfCounts members
+static const std::array<std::pair<uint32_t, uint64_t>, 5> typesAndConfigs = {{
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE, getCacheReadMissConfig(PERF_COUNT_HW_CACHE_L1D)},
+        {PERF_TYPE_HW_CACHE, getCacheReadMissConfig(PERF_COUNT_HW_CACHE_LL)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}
+}};
+
+static int openCounter(uint32_t type, uint64_t config, int groupFd) noexcept {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+PerfCounterGroup::PerfCounterGroup() noexcept : leaderFd(-1), numOpenCounters(0) {
+    fds.fill(-1);
+    groupIndices.fill(-1);
+
+    for (SizeType i = 0; i < numCounters; ++i) {
+        fds[i] = openCounter(typesAndConfigs[i].first, typesAndConfigs[i].second, leaderFd);
+
+        if (fds[i] >= 0) {
+            groupIndices[i] = static_cast<int>(numOpenCounters++);
+
+            if (leaderFd < 0) {
+                leaderFd = fds[i];
+            }
+        }
+    }
+}
+
+PerfCounterGroup::~PerfCounterGroup() {
+    for (auto fd : fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+PerfCounts PerfCounterGroup::read() const noexcept {
+    PerfCounts counts;
+
+    if (leaderFd < 0) {
+        return counts;
+    }
+
+    // layout of a group read: number of values, time enabled, time running, then one value per counter
+    std::array<uint64_t, numCounters + 3> buffer{};
+    if (::read(leaderFd, buffer.data(), sizeof(buffer)) <= 0) {
+        return counts;
+    }
+
+    counts.timeEnabled = buffer[1];
+    counts.timeRunning = buffer[2];
+
+    std::array<uint64_t*, numCounters> members = {
+            &counts.cycles,
+            &counts.instructions,
+            &counts.l1dReadMisses,
+            &counts.llcReadMisses,
+            &counts.branchMisses
+    };
+
+    for (SizeType i = 0; i < numCounters; ++i) {
+        if (groupIndices[i] >= 0) {
+            *members[i] = buffer[3 + groupIndices[i]];
+        }
+    }
+
+    return counts;
+}
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <boost/core/noncopyable.hpp>
+
+namespace soft_npu {
+
+struct PerfCounts {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t l1dReadMisses = 0;
+    uint64_t llcReadMisses = 0;
+    uint64_t branchMisses = 0;
+
+    // nanoseconds the group was enabled and actually counting; they differ when the kernel multiplexes the group with
+    // other users of the counters
+    uint64_t timeEnabled = 0;
+    uint64_t timeRunning = 0;
+
+    PerfCounts& operator+=(const PerfCounts& rhs) noexcept;
+    PerfCounts operator-(const PerfCounts& rhs) const noexcept;
+
+    // the counts were never scheduled onto the PMU and are unknown rather than zero
+    bool isUnavailable() const noexcept {
+        return timeRunning == 0;
+    }
+
+    // extrapolates the counts to the time the group was enabled, as perf does for multiplexed counters
+    PerfCounts getScaled() const noexcept;
+};
+
+struct PhasePerfCounts {
+    std::string phaseName;
+    PerfCounts counts;
+};
+
+// Hardware counters of the calling thread (user space only), opened with perf_event_open as one group so that they
+// are scheduled together. Counters that the kernel or the (virtual) machine does not provide read as zero. Reads are
+// raw; scale differences of reads with PerfCounts::getScaled.
+class PerfCounterGroup : private boost::noncopyable {
+public:
+    PerfCounterGroup() noexcept;
+    ~PerfCounterGroup();
+
+    bool isAvailable() const noexcept {
+        return leaderFd >= 0;
+    }
+
+    PerfCounts read() const noexcept;
+
+private:
+    static constexpr SizeType numCounters = 5;
+
+    int leaderFd;
+    std::array<int, numCounters> fds;
+    // position of each opened counter in a group read, in the order the counters joined the group
+    std::array<int, numCounters> groupIndices;
+    SizeType numOpenCounters;
+};
+
+// adds the counts of the enclosing scope to the given counts; empty and optimized away unless built with
+// SOFT_NPU_PERF_COUNTERS
+class ScopedPerfCounts {
+public:
+#ifdef SOFT_NPU_PERF_COUNTERS
+    explicit ScopedPerfCounts(PerfCounts& counts) noexcept :
+            counts(counts), startCounts(perfCounterGroup.read()) {
+    }
+
+    ~ScopedPerfCounts() {
+        counts += perfCounterGroup.read() - startCounts;
+    }
+
+private:
+    PerfCounterGroup perfCounterGroup;
+    PerfCounts& counts;
+    const PerfCounts startCounts;
+#else
+    explicit ScopedPerfCounts(PerfCounts&) noexcept {}
+#endif
+};
+
+}
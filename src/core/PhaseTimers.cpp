@@ -0,0 +1,64 @@
+#include "PhaseTimers.hpp"
+#include <stdexcept>
+
+namespace soft_npu {
+
+const char* toString(CyclePhase phase) {
+    switch (phase) {
+        case CyclePhase::channelProjection:
+            return "channel projection";
+        case CyclePhase::nonCoherentStimulation:
+            return "non-coherent stimulation";
+        case CyclePhase::transmissionEvents:
+            return "transmission events";
+        case CyclePhase::thresholdEvaluation:
+            return "threshold evaluation";
+        case CyclePhase::commonEvents:
+            return "common events";
+        case CyclePhase::spikeListeners:
+            return "spike listeners";
+        case CyclePhase::dopamineRelease:
+            return "dopamine release";
+        default:
+            throw std::runtime_error("Unknown cycle phase");
+    }
+}
+
+PhaseTimers::PhaseTimers() noexcept :
+        numTicksByPhase{},
+        startTicks(readTimeStampCounter()),
+        startTs(std::chrono::steady_clock::now()) {
+}
+
+std::vector<PhaseWallTime> PhaseTimers::getPhaseWallTimes() const {
+    std::vector<PhaseWallTime> phaseWallTimes;
+
+#ifdef SOFT_NPU_PHASE_TIMERS
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTs;
+    double ticksPerSecond = (readTimeStampCounter() - startTicks) / elapsed.count();
+
+    for (SizeType phase = 0; phase < numTicksByPhase.size(); ++phase) {
+        phaseWallTimes.push_back({toString(static_cast<CyclePhase>(phase)), numTicksByPhase[phase] / ticksPerSecond});
+    }
+#endif
+
+    return phaseWallTimes;
+}
+
+std::vector<PhasePerfCounts> PhaseTimers::getPhasePerfCounts() const {
+    std::vector<PhasePerfCounts> phasePerfCounts;
+
+#ifdef SOFT_NPU_PERF_COUNTERS
+    if (!perfCounterGroup.isAvailable()) {
+        return phasePerfCounts;
+    }
+
+    for (SizeType phase = 0; phase < perfCountsByPhase.size(); ++phase) {
+        phasePerfCounts.push_back({toString(static_cast<CyclePhase>(phase)), perfCountsByPhase[phase].getScaled()});
+    }
+#endif
+
+    return phasePerfCounts;
+}
+
+}
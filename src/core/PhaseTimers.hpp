@@ -0,0 +1,137 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include "PerfCounters.hpp"
+#include <util/Tracer.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace soft_npu {
+
+enum class CyclePhase : SizeType {
+    channelProjection,
+    nonCoherentStimulation,
+    transmissionEvents,
+    thresholdEvaluation,
+    commonEvents,
+    spikeListeners,
+    dopamineRelease,
+    numPhases
+};
+
+const char* toString(CyclePhase);
+
+struct PhaseWallTime {
+    std::string phaseName;
+    double wallTime;
+};
+
+inline uint64_t readTimeStampCounter() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+// Accumulates time stamp counter ticks and, with SOFT_NPU_PERF_COUNTERS, hardware counts of the owning thread per
+// cycle phase. The counter frequency is calibrated against the steady clock over the lifetime of the object.
+class PhaseTimers : private boost::noncopyable {
+public:
+    PhaseTimers() noexcept;
+
+    void addTicks(CyclePhase phase, uint64_t numTicks) noexcept {
+        numTicksByPhase[static_cast<SizeType>(phase)] += numTicks;
+    }
+
+#ifdef SOFT_NPU_PERF_COUNTERS
+    PerfCounts readPerfCounts() const noexcept {
+        return perfCounterGroup.read();
+    }
+
+    void addPerfCounts(CyclePhase phase, const PerfCounts& counts) noexcept {
+        perfCountsByPhase[static_cast<SizeType>(phase)] += counts;
+    }
+#endif
+
+    // empty unless built with SOFT_NPU_PHASE_TIMERS
+    std::vector<PhaseWallTime> getPhaseWallTimes() const;
+
+    // empty unless built with SOFT_NPU_PERF_COUNTERS and the hardware counters could be opened
+    std::vector<PhasePerfCounts> getPhasePerfCounts() const;
+
+private:
+    std::array<uint64_t, static_cast<SizeType>(CyclePhase::numPhases)> numTicksByPhase;
+    const uint64_t startTicks;
+    const std::chrono::steady_clock::time_point startTs;
+#ifdef SOFT_NPU_PERF_COUNTERS
+    PerfCounterGroup perfCounterGroup;
+    std::array<PerfCounts, static_cast<SizeType>(CyclePhase::numPhases)> perfCountsByPhase;
+#endif
+};
+
+// times the enclosing scope and counts its hardware events; empty and optimized away unless built with
+// SOFT_NPU_PHASE_TIMERS or SOFT_NPU_PERF_COUNTERS
+class ScopedPhaseTimer {
+public:
+#if defined(SOFT_NPU_PHASE_TIMERS) || defined(SOFT_NPU_PERF_COUNTERS)
+    ScopedPhaseTimer(PhaseTimers& phaseTimers, CyclePhase phase) noexcept :
+            phaseTimers(phaseTimers),
+            phase(phase) {
+#ifdef SOFT_NPU_PERF_COUNTERS
+        startCounts = phaseTimers.readPerfCounts();
+#endif
+#ifdef SOFT_NPU_PHASE_TIMERS
+        startTicks = readTimeStampCounter();
+#endif
+    }
+
+    ~ScopedPhaseTimer() {
+#ifdef SOFT_NPU_PHASE_TIMERS
+        phaseTimers.addTicks(phase, readTimeStampCounter() - startTicks);
+#endif
+#ifdef SOFT_NPU_PERF_COUNTERS
+        phaseTimers.addPerfCounts(phase, phaseTimers.readPerfCounts() - startCounts);
+#endif
+    }
+
+private:
+    PhaseTimers& phaseTimers;
+    const CyclePhase phase;
+#ifdef SOFT_NPU_PHASE_TIMERS
+    uint64_t startTicks;
+#endif
+#ifdef SOFT_NPU_PERF_COUNTERS
+    PerfCounts startCounts;
+#endif
+#else
+    ScopedPhaseTimer(PhaseTimers&, CyclePhase) noexcept {}
+#endif
+};
+
+// traces the enclosing phase of a cycle sampled for tracing; empty for all other cycles, which the caller decides once
+// per cycle
+template<bool isTraced>
+class ScopedPhaseTraceSpan {
+public:
+    ScopedPhaseTraceSpan(CyclePhase, SizeType) noexcept {}
+};
+
+template<>
+class ScopedPhaseTraceSpan<true> {
+public:
+    ScopedPhaseTraceSpan(CyclePhase phase, SizeType cycleId) noexcept :
+            traceSpan(toString(phase), "cycle", static_cast<int64_t>(cycleId)) {
+    }
+
+private:
+    ScopedTraceSpan traceSpan;
+};
+
+}
@@ -0,0 +1,51 @@
+#include "PopulationPartition.hpp"
+#include <neuro/Population.hpp>
+#include <limits>
+
+namespace soft_npu {
+
+PopulationPartition::PopulationPartition(SizeType populationSize, SizeType numPartitions, SizeType partitionId) :
+        numPartitions(numPartitions),
+        partitionId(partitionId),
+        neuronIdRange(getNeuronIdRange(populationSize, numPartitions, partitionId)),
+        population(std::make_shared<Population>()),
+        inboundSynapsesByNeuronId(populationSize),
+        isInhibitoryByNeuronId(populationSize) {
+}
+
+// neuron i belongs to partition i * numPartitions / populationSize
+std::pair<SizeType, SizeType> PopulationPartition::getNeuronIdRange(
+        SizeType populationSize, SizeType numPartitions, SizeType partitionId) noexcept {
+
+    auto getFirstNeuronId = [populationSize, numPartitions](SizeType id) {
+        return (id * populationSize + numPartitions - 1) / numPartitions;
+    };
+
+    return {getFirstNeuronId(partitionId), getFirstNeuronId(partitionId + 1)};
+}
+
+void PopulationPartition::addSynapse(
+        SizeType preSynapticNeuronId,
+        bool isPreSynapticNeuronInhibitory,
+        SizeType synapseIndex,
+        Synapse* synapse) {
+
+    inboundSynapsesByNeuronId[preSynapticNeuronId].push_back({synapseIndex, synapse});
+    isInhibitoryByNeuronId[preSynapticNeuronId] = isPreSynapticNeuronInhibitory;
+}
+
+TimeType PopulationPartition::getMinRemoteConductionDelay() const noexcept {
+    auto minDelay = std::numeric_limits<TimeType>::infinity();
+
+    for (SizeType neuronId = 0; neuronId < inboundSynapsesByNeuronId.size(); ++neuronId) {
+        if (!isLocal(neuronId)) {
+            for (const auto& inboundSynapse : inboundSynapsesByNeuronId[neuronId]) {
+                minDelay = std::min(minDelay, inboundSynapse.synapse->conductionDelay);
+            }
+        }
+    }
+
+    return minDelay;
+}
+
+}
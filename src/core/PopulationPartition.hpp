@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+
+namespace soft_npu {
+
+class Population;
+struct Synapse;
+
+// One of several partitions of a population, each made of a contiguous range of neuron ids, as generated by the process
+// that simulates it. The population holds the local neurons, the other ids are taken by remote neurons. Local neurons
+// have no outbound synapses: the synapses onto local neurons, whether from local or remote neurons, are kept here by
+// pre-synaptic neuron, along with their index among the outbound synapses of that neuron in the full population. The
+// pre-synaptic neuron id and this index identify a synapse across partitions.
+class PopulationPartition : private boost::noncopyable {
+public:
+    struct InboundSynapse {
+        SizeType synapseIndex;
+        Synapse* synapse;
+    };
+
+    PopulationPartition(SizeType populationSize, SizeType numPartitions, SizeType partitionId);
+
+    // first and one past the last neuron id of the partition
+    static std::pair<SizeType, SizeType> getNeuronIdRange(
+            SizeType populationSize, SizeType numPartitions, SizeType partitionId) noexcept;
+
+    Population& getPopulation() noexcept {
+        return *population;
+    }
+
+    const Population& getPopulation() const noexcept {
+        return *population;
+    }
+
+    std::shared_ptr<Population> getSharedPopulation() const noexcept {
+        return population;
+    }
+
+    SizeType getNumPartitions() const noexcept {
+        return numPartitions;
+    }
+
+    SizeType getPartitionId() const noexcept {
+        return partitionId;
+    }
+
+    bool isLocal(SizeType neuronId) const noexcept {
+        return neuronId >= neuronIdRange.first && neuronId < neuronIdRange.second;
+    }
+
+    // in ascending synapse index per pre-synaptic neuron
+    void addSynapse(
+            SizeType preSynapticNeuronId,
+            bool isPreSynapticNeuronInhibitory,
+            SizeType synapseIndex,
+            Synapse* synapse);
+
+    const std::vector<InboundSynapse>& getInboundSynapses(SizeType preSynapticNeuronId) const noexcept {
+        return inboundSynapsesByNeuronId[preSynapticNeuronId];
+    }
+
+    // only known for neurons with synapses onto the partition
+    bool isInhibitory(SizeType neuronId) const noexcept {
+        return isInhibitoryByNeuronId[neuronId];
+    }
+
+    // infinity if no remote neuron has synapses onto the partition
+    TimeType getMinRemoteConductionDelay() const noexcept;
+
+private:
+    SizeType numPartitions;
+    SizeType partitionId;
+    std::pair<SizeType, SizeType> neuronIdRange;
+    std::shared_ptr<Population> population;
+    std::vector<std::vector<InboundSynapse>> inboundSynapsesByNeuronId;
+    std::vector<char> isInhibitoryByNeuronId;
+};
+
+}
@@ -0,0 +1,383 @@
+#include "QuantizedInferenceEngine.hpp"
+#include "EventProcessor.hpp"
+#include "EventLoadStats.hpp"
+#include "PhaseTimers.hpp"
+#include "StaticContext.hpp"
+#include "CycleOutputBuffer.hpp"
+#include "SynapticTransmissionStats.hpp"
+#include <neuro/Population.hpp>
+#include <neuro/Synapse.hpp>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+
+namespace soft_npu {
+
+namespace {
+
+// rounds half up, also for negative values
+int64_t multiplyShift(int64_t value, int64_t multiplier, SizeType shift) noexcept {
+    return (value * multiplier + (static_cast<int64_t>(1) << (shift - 1))) >> shift;
+}
+
+int32_t saturate(int64_t value) noexcept {
+    return static_cast<int32_t>(std::clamp(
+            value,
+            static_cast<int64_t>(std::numeric_limits<int32_t>::lowest()),
+            static_cast<int64_t>(std::numeric_limits<int32_t>::max())));
+}
+
+// the same offsets as EventProcessor::getTargetOffset
+SizeType getDelayNumCycles(TimeType delay, TimeType dt) {
+    ValueType frequency = 1 / dt;
+    return std::max(static_cast<SizeType>(1), static_cast<SizeType>(ceil(delay * frequency)));
+}
+
+SizeType getMaxDelayNumCycles(const Population& population, TimeType dt) {
+    SizeType maxDelayNumCycles = 1;
+
+    for (auto neuronIt = population.cbeginNeurons(); neuronIt != population.cendNeurons(); ++neuronIt) {
+        if (*neuronIt == nullptr) {
+            throw std::runtime_error("Quantized inference cannot be used with partitions");
+        }
+
+        for (auto synIt = (*neuronIt)->cbeginOutboundSynapses(); synIt != (*neuronIt)->cendOutboundSynapses(); ++synIt) {
+            maxDelayNumCycles = std::max(maxDelayNumCycles, getDelayNumCycles((*synIt)->conductionDelay, dt));
+        }
+    }
+
+    if (maxDelayNumCycles > std::numeric_limits<uint16_t>::max()) {
+        throw std::runtime_error("Conduction delays are too long for quantized inference");
+    }
+
+    return maxDelayNumCycles;
+}
+
+// the neuron is refractory while the time is before its spike time plus the refractory period
+SizeType getRefractoryNumCycles(TimeType refractoryPeriod, TimeType dt) {
+    auto refractoryNumCycles = static_cast<SizeType>(std::ceil(refractoryPeriod / dt));
+
+    if (refractoryNumCycles > 0 && (refractoryNumCycles - 1) * dt >= refractoryPeriod) {
+        -- refractoryNumCycles;
+    }
+
+    return refractoryNumCycles;
+}
+
+using NeuronParamsKey = std::tuple<TimeType, ValueType, TimeType, ValueType, ValueType, ValueType>;
+
+NeuronParamsKey makeNeuronParamsKey(const NeuronParams& neuronParams) {
+    return {
+        neuronParams.timeConstantInverse,
+        neuronParams.epspOverrideScaleFactor,
+        neuronParams.refractoryPeriod,
+        neuronParams.thresholdVoltage,
+        neuronParams.resetVoltage,
+        neuronParams.voltageFloor
+    };
+}
+
+}
+
+QuantizedInferenceEngine::QuantizedInferenceEngine(const Population& population, TimeType dt, SizeType weightBits) :
+        weightBits(weightBits),
+        weightScale(1),
+        voltageScale(1),
+        transmissionBuffer(getMaxDelayNumCycles(population, dt) + 1, 0),
+        numEventsProcessed(0) {
+
+    if (weightBits != 8 && weightBits != 16) {
+        throw std::runtime_error("Quantized weights must have 8 or 16 bits");
+    }
+
+    auto populationSize = population.getPopulationSize();
+
+    if (populationSize > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("Population is too large for quantized inference");
+    }
+
+    // neurons with equal params share a type
+    std::map<NeuronParamsKey, uint16_t> neuronTypeIdsByParams;
+    std::vector<const NeuronParams*> neuronTypeParams;
+    ValueType maxAbsVoltage = 0;
+    ValueType maxAbsWeight = 0;
+
+    for (auto neuronIt = population.cbeginNeurons(); neuronIt != population.cendNeurons(); ++neuronIt) {
+        const auto& neuron = **neuronIt;
+        const auto& neuronParams = *neuron.getNeuronParams();
+
+        auto [typeIt, isNewType] = neuronTypeIdsByParams.emplace(
+                makeNeuronParamsKey(neuronParams), static_cast<uint16_t>(neuronTypeParams.size()));
+
+        if (isNewType) {
+            if (neuronTypeParams.size() > std::numeric_limits<uint16_t>::max()) {
+                throw std::runtime_error("Too many distinct neuron params for quantized inference");
+            }
+
+            neuronTypeParams.push_back(&neuronParams);
+            maxAbsVoltage = std::max({
+                maxAbsVoltage,
+                std::abs(neuronParams.thresholdVoltage),
+                std::abs(neuronParams.resetVoltage),
+                std::abs(neuronParams.voltageFloor)});
+        }
+
+        neuronTypeIds.push_back(typeIt->second);
+
+        for (auto synIt = neuron.cbeginOutboundSynapses(); synIt != neuron.cendOutboundSynapses(); ++synIt) {
+            if ((*synIt)->synapseParams->shortTermPlasticityParams) {
+                throw std::runtime_error("Quantized inference does not support short-term plasticity");
+            }
+
+            maxAbsWeight = std::max(maxAbsWeight, std::abs((*synIt)->weight));
+        }
+    }
+
+    // leaves a factor of 128 above the largest threshold, reset and floor voltage for the epsps of one cycle
+    voltageScale = (maxAbsVoltage > 0 ? maxAbsVoltage : 1) / static_cast<ValueType>(1 << 24);
+
+    auto maxQuantizedWeight = (static_cast<int64_t>(1) << (weightBits - 1)) - 1;
+    weightScale = (maxAbsWeight > 0 ? maxAbsWeight : 1) / static_cast<ValueType>(maxQuantizedWeight);
+
+    for (auto neuronParams : neuronTypeParams) {
+        NeuronType neuronType{};
+        neuronType.thresholdVoltage = saturate(std::llround(neuronParams->thresholdVoltage / voltageScale));
+        neuronType.resetVoltage = saturate(std::llround(neuronParams->resetVoltage / voltageScale));
+        neuronType.voltageFloor = saturate(std::llround(neuronParams->voltageFloor / voltageScale));
+        neuronType.refractoryNumCycles = getRefractoryNumCycles(neuronParams->refractoryPeriod, dt);
+        neuronType.epspOverrideScaleFactor = neuronParams->epspOverrideScaleFactor;
+        neuronType.epspMultiplier = std::llround(
+                std::ldexp(weightScale * neuronParams->epspOverrideScaleFactor / voltageScale, epspMultiplierShift));
+
+        for (SizeType i = 0; i < neuronType.decayMultipliers.size(); ++i) {
+            neuronType.decayMultipliers[i] = std::llround(std::ldexp(
+                    std::exp(- std::ldexp(1.0, i) * dt * neuronParams->timeConstantInverse), decayShift));
+        }
+
+        neuronTypes.push_back(neuronType);
+    }
+
+    voltages.resize(populationSize, 0);
+    lastCycleIds.resize(populationSize, 0);
+    lastSpikeCycleIds.resize(populationSize, noSpikeCycleId);
+    isThresholdEvalPending.resize(populationSize, false);
+
+    synapseOffsets.push_back(0);
+    inhibitionSourceOffsets.push_back(0);
+
+    for (auto neuronIt = population.cbeginNeurons(); neuronIt != population.cendNeurons(); ++neuronIt) {
+        const auto& neuron = **neuronIt;
+        int64_t signum = neuron.getNeuronParams()->isInhibitory ? -1 : 1;
+
+        for (auto synIt = neuron.cbeginOutboundSynapses(); synIt != neuron.cendOutboundSynapses(); ++synIt) {
+            const auto& synapse = **synIt;
+            auto weight = signum * std::min(static_cast<int64_t>(std::llround(std::abs(synapse.weight) / weightScale)), maxQuantizedWeight);
+
+            postSynapticNeuronIds.push_back(static_cast<uint32_t>(synapse.postSynapticNeuron->getNeuronId()));
+            delayNumCycles.push_back(static_cast<uint16_t>(getDelayNumCycles(synapse.conductionDelay, dt)));
+
+            if (weightBits == 8) {
+                weights8.push_back(static_cast<int8_t>(weight));
+            } else {
+                weights16.push_back(static_cast<int16_t>(weight));
+            }
+        }
+
+        synapseOffsets.push_back(postSynapticNeuronIds.size());
+
+        for (auto sourceIt = neuron.cbeginInhibitionSources(); sourceIt != neuron.cendInhibitionSources(); ++sourceIt) {
+            inhibitionSourceIds.push_back(static_cast<uint32_t>((*sourceIt)->getNeuronId()));
+        }
+
+        inhibitionSourceOffsets.push_back(inhibitionSourceIds.size());
+    }
+}
+
+template<bool isTraced>
+void QuantizedInferenceEngine::processCycle(const CycleContext& ctx, EventProcessor& eventProcessor) {
+
+    auto& phaseTimers = ctx.staticContext.phaseTimers;
+    auto& eventLoadStats = ctx.staticContext.eventLoadStats;
+    auto cycleId = ctx.cycleId;
+
+    {
+        ScopedPhaseTimer phaseTimer(phaseTimers, CyclePhase::transmissionEvents);
+        ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::transmissionEvents, cycleId);
+
+        SizeType numTransmissions = transmissionBuffer.sizeAtCurrentLocation();
+
+        for (auto cit = transmissionBuffer.cBeginElementsAtCurrentLocation(); cit != transmissionBuffer.cEndElementsAtCurrentLocation(); ++cit) {
+            const auto& neuronType = neuronTypes[neuronTypeIds[cit->targetNeuronId]];
+            produceEPSP(cycleId, cit->targetNeuronId, multiplyShift(cit->weight, neuronType.epspMultiplier, epspMultiplierShift));
+        }
+
+        // pushed during this cycle, so they follow the synaptic transmissions as with the double engine
+        eventProcessor.forEachTransmissionEventAtCurrentLocation([this, cycleId, &numTransmissions](const TransmissionEvent& event) {
+            auto neuronId = event.getTargetNeuron().getNeuronId();
+            const auto& neuronType = neuronTypes[neuronTypeIds[neuronId]];
+            produceEPSP(cycleId, neuronId, std::llround(event.getUnscaledEpsp() * neuronType.epspOverrideScaleFactor / voltageScale));
+            ++ numTransmissions;
+        });
+
+        eventLoadStats.record(EventQueue::transmissionEventsPerSlot, numTransmissions);
+        numEventsProcessed += numTransmissions;
+    }
+
+    {
+        ScopedPhaseTimer phaseTimer(phaseTimers, CyclePhase::thresholdEvaluation);
+        ScopedPhaseTraceSpan<isTraced> phaseTraceSpan(CyclePhase::thresholdEvaluation, cycleId);
+        eventLoadStats.record(EventQueue::thresholdEvalCandidates, firingThresholdEvalCandidates.size());
+
+        if (weightBits == 8) {
+            processFiringThresholdEvalCandidates(ctx, weights8);
+        } else {
+            processFiringThresholdEvalCandidates(ctx, weights16);
+        }
+    }
+
+    transmissionBuffer.clearAndAdvance();
+    eventProcessor.processCommonEventsAndAdvance<isTraced>(ctx);
+}
+
+template void QuantizedInferenceEngine::processCycle<false>(const CycleContext&, EventProcessor&);
+template void QuantizedInferenceEngine::processCycle<true>(const CycleContext&, EventProcessor&);
+
+template<typename WeightType>
+void QuantizedInferenceEngine::processFiringThresholdEvalCandidates(
+        const CycleContext& ctx, const std::vector<WeightType>& weights) {
+
+    SizeType numSpikes = 0;
+
+    // in candidate order, as neurons with continuous inhibition depend on sources firing earlier in this stage
+    for (auto neuronId : firingThresholdEvalCandidates) {
+        isThresholdEvalPending[neuronId] = false;
+
+        int64_t compareVoltage = voltages[neuronId];
+        if (hasContinuousInhibition(neuronId)) {
+            compareVoltage -= getContinuousInhibition(neuronId, ctx.cycleId);
+        }
+
+        if (compareVoltage >= neuronTypes[neuronTypeIds[neuronId]].thresholdVoltage) {
+            fire(ctx, neuronId, weights);
+            ++ numSpikes;
+        }
+    }
+
+    auto numCandidates = firingThresholdEvalCandidates.size();
+    firingThresholdEvalCandidates.clear();
+
+    lastCycleFiringThresholdEvalStats.numCandidates = numCandidates;
+    lastCycleFiringThresholdEvalStats.numSpikes = numSpikes;
+    totalFiringThresholdEvalStats.numCandidates += numCandidates;
+    totalFiringThresholdEvalStats.numSpikes += numSpikes;
+    numEventsProcessed += numCandidates;
+}
+
+template<typename WeightType>
+void QuantizedInferenceEngine::fire(const CycleContext& ctx, SizeType neuronId, const std::vector<WeightType>& weights) {
+
+    const auto& neuronType = neuronTypes[neuronTypeIds[neuronId]];
+
+    voltages[neuronId] = neuronType.resetVoltage;
+    lastCycleIds[neuronId] = ctx.cycleId + neuronType.refractoryNumCycles;
+    lastSpikeCycleIds[neuronId] = ctx.cycleId;
+
+    auto synapseBegin = synapseOffsets[neuronId];
+    auto synapseEnd = synapseOffsets[neuronId + 1];
+
+    for (auto synapseIndex = synapseBegin; synapseIndex < synapseEnd; ++synapseIndex) {
+        transmissionBuffer.emplaceAtOffset(
+                delayNumCycles[synapseIndex],
+                Transmission{postSynapticNeuronIds[synapseIndex], weights[synapseIndex]});
+    }
+
+    ctx.staticContext.cycleOutputBuffer.addNeuronSpike(neuronId);
+    ctx.staticContext.synapticTransmissionStats.increaseTransmissionCount(synapseEnd - synapseBegin);
+}
+
+void QuantizedInferenceEngine::produceEPSP(SizeType cycleId, SizeType neuronId, int64_t epsp) noexcept {
+
+    if (cycleId < lastCycleIds[neuronId]) {
+        return;
+    }
+
+    const auto& neuronType = neuronTypes[neuronTypeIds[neuronId]];
+
+    auto voltage = saturate(std::max(
+            static_cast<int64_t>(getMembraneVoltage(neuronId, cycleId)) + epsp,
+            static_cast<int64_t>(neuronType.voltageFloor)));
+
+    voltages[neuronId] = voltage;
+    lastCycleIds[neuronId] = cycleId;
+
+    // a neuron with continuous inhibition stays a separate candidate for each threshold crossing
+    if (voltage >= neuronType.thresholdVoltage && (!isThresholdEvalPending[neuronId] || hasContinuousInhibition(neuronId))) {
+        isThresholdEvalPending[neuronId] = true;
+        firingThresholdEvalCandidates.push_back(static_cast<uint32_t>(neuronId));
+    }
+}
+
+QuantizedInferenceEngine::VoltageType QuantizedInferenceEngine::getMembraneVoltage(
+        SizeType neuronId, SizeType cycleId) const noexcept {
+
+    auto lastCycleId = lastCycleIds[neuronId];
+
+    if (cycleId <= lastCycleId) {
+        return voltages[neuronId];
+    }
+
+    // a spike of a continuous inhibition source since the last update resets the voltage
+    for (auto i = inhibitionSourceOffsets[neuronId]; i < inhibitionSourceOffsets[neuronId + 1]; ++i) {
+        auto sourceSpikeCycleId = lastSpikeCycleIds[inhibitionSourceIds[i]];
+
+        if (sourceSpikeCycleId != noSpikeCycleId && sourceSpikeCycleId >= lastCycleId) {
+            return neuronTypes[neuronTypeIds[neuronId]].resetVoltage;
+        }
+    }
+
+    // the per-cycle decay applied once per elapsed cycle, composed from the decays over powers of two cycles
+    const auto& decayMultipliers = neuronTypes[neuronTypeIds[neuronId]].decayMultipliers;
+    int64_t voltage = voltages[neuronId];
+
+    for (SizeType i = 0, numCycles = cycleId - lastCycleId; numCycles != 0 && voltage != 0; ++i, numCycles >>= 1) {
+        if (numCycles & 1) {
+            voltage = multiplyShift(voltage, decayMultipliers[i], decayShift);
+        }
+    }
+
+    return static_cast<VoltageType>(voltage);
+}
+
+int64_t QuantizedInferenceEngine::getContinuousInhibition(SizeType neuronId, SizeType cycleId) const noexcept {
+    int64_t continuousInhibition = 0;
+
+    for (auto i = inhibitionSourceOffsets[neuronId]; i < inhibitionSourceOffsets[neuronId + 1]; ++i) {
+        continuousInhibition += getMembraneVoltage(inhibitionSourceIds[i], cycleId);
+    }
+
+    return continuousInhibition;
+}
+
+ValueType QuantizedInferenceEngine::getWeight(SizeType neuronId, SizeType outboundSynapseIndex) const noexcept {
+    auto synapseIndex = synapseOffsets[neuronId] + outboundSynapseIndex;
+    return (weightBits == 8 ? weights8[synapseIndex] : weights16[synapseIndex]) * weightScale;
+}
+
+SizeType QuantizedInferenceEngine::getNumStorageBytes() const noexcept {
+    return neuronTypeIds.size() * sizeof(uint16_t) +
+        voltages.size() * sizeof(VoltageType) +
+        lastCycleIds.size() * sizeof(SizeType) +
+        lastSpikeCycleIds.size() * sizeof(SizeType) +
+        isThresholdEvalPending.size() * sizeof(char) +
+        synapseOffsets.size() * sizeof(SizeType) +
+        postSynapticNeuronIds.size() * sizeof(uint32_t) +
+        delayNumCycles.size() * sizeof(uint16_t) +
+        weights8.size() * sizeof(int8_t) +
+        weights16.size() * sizeof(int16_t) +
+        inhibitionSourceOffsets.size() * sizeof(SizeType) +
+        inhibitionSourceIds.size() * sizeof(uint32_t);
+}
+
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include "BatchedRingBuffer.hpp"
+#include "FiringThresholdEvalStats.hpp"
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+
+namespace soft_npu {
+
+class Population;
+class EventProcessor;
+struct CycleContext;
+
+// Inference-only engine for a trained population, taking the place of the event processor's transmission and threshold
+// stages (see the quantizedInference params section). The population is read once: weights are packed as int8 or int16
+// with one scale for the population, membrane voltages are int32 fixed point and decay by integer multiply-shift, and
+// neurons and synapses are kept as arrays indexed by neuron id and by outbound synapse. Inputs still arrive as the
+// event processor's immediate transmission events and spikes leave through the cycle output buffer, so channel
+// projection and stimulation behave as with the double engine. Spike timing, refractory periods and continuous
+// inhibition follow the double engine up to the rounding of weights and voltages. Short-term plasticity is not
+// supported.
+class QuantizedInferenceEngine : private boost::noncopyable {
+public:
+    using VoltageType = int32_t;
+
+    QuantizedInferenceEngine(const Population& population, TimeType dt, SizeType weightBits);
+
+    // the immediate transmission events of the event processor are taken over; its common events are processed last
+    template<bool isTraced = false>
+    void processCycle(const CycleContext& ctx, EventProcessor& eventProcessor);
+
+    SizeType getWeightBits() const noexcept {
+        return weightBits;
+    }
+
+    // the weight of one quantization step
+    ValueType getWeightScale() const noexcept {
+        return weightScale;
+    }
+
+    // the voltage of one fixed point unit
+    ValueType getVoltageScale() const noexcept {
+        return voltageScale;
+    }
+
+    // the weight as stored, for comparison with the weight of the population
+    ValueType getWeight(SizeType neuronId, SizeType outboundSynapseIndex) const noexcept;
+
+    // packed neuron and synapse state
+    SizeType getNumStorageBytes() const noexcept;
+
+    uint64_t getNumEventsProcessed() const noexcept {
+        return numEventsProcessed;
+    }
+
+    const FiringThresholdEvalStats& getLastCycleFiringThresholdEvalStats() const noexcept {
+        return lastCycleFiringThresholdEvalStats;
+    }
+
+    const FiringThresholdEvalStats& getTotalFiringThresholdEvalStats() const noexcept {
+        return totalFiringThresholdEvalStats;
+    }
+
+private:
+    static constexpr SizeType decayShift = 30;
+    static constexpr SizeType epspMultiplierShift = 16;
+    static constexpr SizeType noSpikeCycleId = std::numeric_limits<SizeType>::max();
+
+    struct NeuronType {
+        VoltageType thresholdVoltage;
+        VoltageType resetVoltage;
+        VoltageType voltageFloor;
+        SizeType refractoryNumCycles;
+        ValueType epspOverrideScaleFactor;
+
+        // fixed point voltage units per weight step, including the epsp override scale factor
+        int64_t epspMultiplier;
+
+        // fixed point with decayShift fraction bits: entry i is the decay over 2^i cycles
+        std::array<int64_t, 64> decayMultipliers;
+    };
+
+    struct Transmission {
+        uint32_t targetNeuronId;
+        int32_t weight;
+    };
+
+    template<typename WeightType>
+    void processFiringThresholdEvalCandidates(const CycleContext& ctx, const std::vector<WeightType>& weights);
+
+    template<typename WeightType>
+    void fire(const CycleContext& ctx, SizeType neuronId, const std::vector<WeightType>& weights);
+
+    void produceEPSP(SizeType cycleId, SizeType neuronId, int64_t epsp) noexcept;
+    VoltageType getMembraneVoltage(SizeType neuronId, SizeType cycleId) const noexcept;
+    int64_t getContinuousInhibition(SizeType neuronId, SizeType cycleId) const noexcept;
+
+    bool hasContinuousInhibition(SizeType neuronId) const noexcept {
+        return inhibitionSourceOffsets[neuronId] != inhibitionSourceOffsets[neuronId + 1];
+    }
+
+    const SizeType weightBits;
+    ValueType weightScale;
+    ValueType voltageScale;
+
+    std::vector<NeuronType> neuronTypes;
+
+    // indexed by neuron id
+    std::vector<uint16_t> neuronTypeIds;
+    std::vector<VoltageType> voltages;
+    // the cycle the voltage was last updated at, or the end of the refractory period
+    std::vector<SizeType> lastCycleIds;
+    std::vector<SizeType> lastSpikeCycleIds;
+    std::vector<char> isThresholdEvalPending;
+
+    // the outbound synapses of neuron i are [synapseOffsets[i], synapseOffsets[i + 1]), in the order of the population
+    std::vector<SizeType> synapseOffsets;
+    std::vector<uint32_t> postSynapticNeuronIds;
+    std::vector<uint16_t> delayNumCycles;
+    // only the one of weightBits is filled; inhibitory weights are negative
+    std::vector<int8_t> weights8;
+    std::vector<int16_t> weights16;
+
+    // the continuous inhibition sources of neuron i are [inhibitionSourceOffsets[i], inhibitionSourceOffsets[i + 1])
+    std::vector<SizeType> inhibitionSourceOffsets;
+    std::vector<uint32_t> inhibitionSourceIds;
+
+    BatchedRingBuffer<Transmission> transmissionBuffer;
+    std::vector<uint32_t> firingThresholdEvalCandidates;
+    FiringThresholdEvalStats lastCycleFiringThresholdEvalStats;
+    FiringThresholdEvalStats totalFiringThresholdEvalStats;
+    uint64_t numEventsProcessed;
+};
+
+}
@@ -19,11 +19,47 @@ std::ostream& operator<<(std::ostream& os, const SimulationResult& simulationRes
         << "Spike processing throughput: " << simulationResult.spikeProcessingThroughput << " per second" << std::endl
         << "Synaptic transmission processing throughput: " << simulationResult.synapticTransmissionProcessingThroughput << " per second" << std::endl;
 
+    for (const auto& phaseWallTime : simulationResult.phaseWallTimes) {
+        os << "Wall time spent in " << phaseWallTime.phaseName << ": " << phaseWallTime.wallTime << " s ("
+            << 100 * phaseWallTime.wallTime / simulationResult.wallTimeEventProcessor << " %)" << std::endl;
+    }
+
+    for (const auto& phasePerfCounts : simulationResult.phasePerfCounts) {
+        const auto& counts = phasePerfCounts.counts;
+
+        if (counts.isUnavailable()) {
+            os << "Hardware counts in " << phasePerfCounts.phaseName << ": unavailable (counters never scheduled)"
+                << std::endl;
+            continue;
+        }
+
+        os << "Hardware counts in " << phasePerfCounts.phaseName << ": "
+            << counts.cycles << " cycles, "
+            << counts.instructions << " instructions (IPC "
+            << (counts.cycles == 0 ? 0.0 : static_cast<double>(counts.instructions) / counts.cycles) << "), "
+            << counts.l1dReadMisses << " L1D read misses, "
+            << counts.llcReadMisses << " LLC read misses, "
+            << counts.branchMisses << " branch misses";
+
+        if (counts.timeRunning < counts.timeEnabled) {
+            os << " (scaled from " << 100.0 * counts.timeRunning / counts.timeEnabled << " % of the time counted)";
+        }
+
+        os << std::endl;
+    }
+
+    for (SizeType queue = 0; queue < static_cast<SizeType>(EventQueue::numQueues); ++queue) {
+        os << "High-water mark of " << toString(static_cast<EventQueue>(queue)) << ": "
+            << simulationResult.eventLoadStats.getQueueLoadStats(static_cast<EventQueue>(queue)).getHighWaterMark()
+            << std::endl;
+    }
+
     return os;
 }
 
 SimulationResult::SimulationResult(TimeType simulationTime, std::vector<NeuronSpikeInfo> recordedSpikes,
                                    std::vector<VoltageRecording> voltageRecordings,
+                                   VoltageSamples voltageSamples,
                                    std::vector<NeuronInfo> neuronInfos,
                                    std::vector<SynapseInfo> finalSynapseInfos,
                                    std::vector<Population::Location> locationsIndexedByNeuronId,
@@ -32,11 +68,15 @@ SimulationResult::SimulationResult(TimeType simulationTime, std::vector<NeuronSp
                                    SizeType numSynapticTransmissions,
                                    double meanExcitatoryFiringRate,
                                    double meanInhibitoryFiringRate, double wallTimeTotal, double wallTimeEventProcessor,
-                                   uint64_t numEventsProcessed) :
+                                   uint64_t numEventsProcessed,
+                                   std::vector<PhaseWallTime> phaseWallTimes,
+                                   std::vector<PhasePerfCounts> phasePerfCounts,
+                                   EventLoadStats eventLoadStats) :
 
         simulationTime(simulationTime),
         recordedSpikes(std::move(recordedSpikes)),
         voltageRecordings(std::move(voltageRecordings)),
+        voltageSamples(std::move(voltageSamples)),
         neuronInfos(std::move(neuronInfos)),
         finalSynapseInfos(std::move(finalSynapseInfos)),
         locationsIndexedByNeuronId(std::move(locationsIndexedByNeuronId)),
@@ -50,6 +90,9 @@ SimulationResult::SimulationResult(TimeType simulationTime, std::vector<NeuronSp
         numEventsProcessed(numEventsProcessed),
         eventThroughput(numEventsProcessed / wallTimeEventProcessor),
         spikeProcessingThroughput((numExcitatorySpikes + numInhibitorySpikes) / wallTimeEventProcessor),
-        synapticTransmissionProcessingThroughput(numSynapticTransmissions / wallTimeEventProcessor)
+        synapticTransmissionProcessingThroughput(numSynapticTransmissions / wallTimeEventProcessor),
+        phaseWallTimes(std::move(phaseWallTimes)),
+        phasePerfCounts(std::move(phasePerfCounts)),
+        eventLoadStats(std::move(eventLoadStats))
 {}
 }
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include "SynapseInfo.hpp"
 #include "NeuronInfo.hpp"
 #include "VoltageRecording.hpp"
+#include "VoltageSamples.hpp"
+#include "PhaseTimers.hpp"
+#include "EventLoadStats.hpp"
 
 namespace soft_npu {
 
@@ -14,6 +17,7 @@ struct SimulationResult {
             TimeType simulationTime,
             std::vector<NeuronSpikeInfo> recordedSpikes,
             std::vector<VoltageRecording> voltageRecordings,
+            VoltageSamples voltageSamples,
             std::vector<NeuronInfo> neuronInfos,
             std::vector<SynapseInfo> finalSynapseInfos,
             std::vector<Population::Location> locationsIndexedByNeuronId,
@@ -24,11 +28,16 @@ struct SimulationResult {
             double meanInhibitoryFiringRate,
             double wallTimeTotal,
             double wallTimeEventProcessor,
-            uint64_t numEventsProcessed);
+            uint64_t numEventsProcessed,
+            std::vector<PhaseWallTime> phaseWallTimes,
+            std::vector<PhasePerfCounts> phasePerfCounts,
+            EventLoadStats eventLoadStats);
 
     TimeType simulationTime;
     const std::vector<NeuronSpikeInfo> recordedSpikes;
     const std::vector<VoltageRecording> voltageRecordings;
+    // of the voltage probe, without the rows flushed to its file
+    const VoltageSamples voltageSamples;
     const std::vector<NeuronInfo> neuronInfos;
     const std::vector<SynapseInfo> finalSynapseInfos;
     const std::vector<Population::Location> locationsIndexedByNeuronId;
@@ -44,6 +53,15 @@ struct SimulationResult {
     const double eventThroughput;
     const double spikeProcessingThroughput;
     const double synapticTransmissionProcessingThroughput;
+
+    // per cycle phase; empty unless built with SOFT_NPU_PHASE_TIMERS
+    const std::vector<PhaseWallTime> phaseWallTimes;
+
+    // population generation followed by the cycle phases; empty unless built with SOFT_NPU_PERF_COUNTERS and the
+    // hardware counters are available
+    const std::vector<PhasePerfCounts> phasePerfCounts;
+
+    const EventLoadStats eventLoadStats;
 };
 
 std::ostream& operator<<(std::ostream& os, const SimulationResult&);
@@ -0,0 +1,82 @@
+#include "SpikeExchange.hpp"
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace soft_npu {
+
+static SizeType alignToCacheLine(SizeType size) {
+    constexpr SizeType cacheLineSize = 64;
+    return (size + cacheLineSize - 1) / cacheLineSize * cacheLineSize;
+}
+
+SpikeExchange::SpikeExchange(SizeType numPartitions, SizeType capacityPerRound) :
+        numPartitions(numPartitions),
+        capacityPerRound(capacityPerRound),
+        slotSize(alignToCacheLine(sizeof(SlotHeader) + capacityPerRound * sizeof(ExchangedSpike))),
+        mappingSize(alignToCacheLine(sizeof(pthread_barrier_t)) + 2 * numPartitions * slotSize),
+        mapping(nullptr),
+        barrier(nullptr),
+        creatorPid(getpid()),
+        numRounds(0) {
+
+    void* address = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (address == MAP_FAILED) {
+        throw std::runtime_error("Could not map shared memory for spike exchange");
+    }
+
+    mapping = static_cast<char*>(address);
+    barrier = reinterpret_cast<pthread_barrier_t*>(mapping);
+
+    pthread_barrierattr_t barrierAttributes;
+    pthread_barrierattr_init(&barrierAttributes);
+    pthread_barrierattr_setpshared(&barrierAttributes, PTHREAD_PROCESS_SHARED);
+    auto errorCode = pthread_barrier_init(barrier, &barrierAttributes, numPartitions);
+    pthread_barrierattr_destroy(&barrierAttributes);
+
+    if (errorCode != 0) {
+        munmap(mapping, mappingSize);
+        throw std::runtime_error("Could not initialize spike exchange barrier");
+    }
+}
+
+SpikeExchange::~SpikeExchange() {
+    if (getpid() == creatorPid) {
+        pthread_barrier_destroy(barrier);
+    }
+
+    munmap(mapping, mappingSize);
+}
+
+SizeType SpikeExchange::getMinimum(SizeType partitionId, SizeType value) {
+    auto parity = numRounds++ % 2;
+    getSlotHeader(parity, partitionId).value = value;
+
+    waitForAllPartitions();
+
+    for (SizeType otherPartitionId = 0; otherPartitionId < numPartitions; ++otherPartitionId) {
+        value = std::min(value, getSlotHeader(parity, otherPartitionId).value);
+    }
+
+    return value;
+}
+
+SpikeExchange::SlotHeader& SpikeExchange::getSlotHeader(SizeType parity, SizeType partitionId) const noexcept {
+    auto offset = alignToCacheLine(sizeof(pthread_barrier_t)) + (parity * numPartitions + partitionId) * slotSize;
+    return *reinterpret_cast<SlotHeader*>(mapping + offset);
+}
+
+ExchangedSpike* SpikeExchange::getSlotSpikes(SizeType parity, SizeType partitionId) const noexcept {
+    return reinterpret_cast<ExchangedSpike*>(&getSlotHeader(parity, partitionId) + 1);
+}
+
+void SpikeExchange::waitForAllPartitions() {
+    auto errorCode = pthread_barrier_wait(barrier);
+
+    if (errorCode != 0 && errorCode != PTHREAD_BARRIER_SERIAL_THREAD) {
+        throw std::runtime_error("Spike exchange barrier wait failed");
+    }
+}
+
+}
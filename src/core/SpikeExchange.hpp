@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include "EventOrderKey.hpp"
+#include <algorithm>
+#include <vector>
+#include <pthread.h>
+#include <boost/core/noncopyable.hpp>
+
+namespace soft_npu {
+
+struct ExchangedSpike {
+    SizeType neuronId;
+    SizeType cycleId;
+
+    // of the event that made the neuron a threshold evaluation candidate
+    EventOrderKey eventOrderKey;
+};
+
+// Exchanges spikes between the processes of a partitioned simulation through anonymous shared memory, which is why it
+// must be created before forking. Each partition publishes into its own slot, in rounds of at most capacityPerRound
+// spikes until all partitions have published all of their spikes. Slots are double buffered, so a single barrier per
+// round suffices.
+class SpikeExchange : private boost::noncopyable {
+public:
+    SpikeExchange(SizeType numPartitions, SizeType capacityPerRound);
+    ~SpikeExchange();
+
+    // publishes the spikes of the given partition, waits for all partitions to do the same and calls f with the id of
+    // the publishing partition for every spike of every partition, including the given one, in partition order per round
+    template<typename F>
+    void exchange(SizeType partitionId, const std::vector<ExchangedSpike>& spikes, F f) {
+        SizeType numPublishedSpikes = 0;
+        bool hasMoreSpikes;
+
+        do {
+            auto parity = numRounds++ % 2;
+            auto numSpikes = std::min(spikes.size() - numPublishedSpikes, capacityPerRound);
+
+            auto& ownSlot = getSlotHeader(parity, partitionId);
+            ownSlot.numSpikes = numSpikes;
+            ownSlot.hasMoreSpikes = numPublishedSpikes + numSpikes < spikes.size();
+            std::copy_n(spikes.cbegin() + numPublishedSpikes, numSpikes, getSlotSpikes(parity, partitionId));
+            numPublishedSpikes += numSpikes;
+
+            waitForAllPartitions();
+
+            hasMoreSpikes = false;
+
+            for (SizeType publishingPartitionId = 0; publishingPartitionId < numPartitions; ++publishingPartitionId) {
+                const auto& slot = getSlotHeader(parity, publishingPartitionId);
+                auto slotSpikes = getSlotSpikes(parity, publishingPartitionId);
+
+                std::for_each(slotSpikes, slotSpikes + slot.numSpikes, [&f, publishingPartitionId](const ExchangedSpike& spike) {
+                    f(publishingPartitionId, spike);
+                });
+
+                hasMoreSpikes = hasMoreSpikes || slot.hasMoreSpikes;
+            }
+        } while (hasMoreSpikes);
+    }
+
+    // the minimum of the values given by all partitions
+    SizeType getMinimum(SizeType partitionId, SizeType value);
+
+private:
+    struct SlotHeader {
+        SizeType numSpikes;
+        SizeType value;
+        bool hasMoreSpikes;
+    };
+
+    SlotHeader& getSlotHeader(SizeType parity, SizeType partitionId) const noexcept;
+    ExchangedSpike* getSlotSpikes(SizeType parity, SizeType partitionId) const noexcept;
+    void waitForAllPartitions();
+
+    const SizeType numPartitions;
+    const SizeType capacityPerRound;
+    const SizeType slotSize;
+    const SizeType mappingSize;
+    char* mapping;
+    pthread_barrier_t* barrier;
+    const pid_t creatorPid;
+    SizeType numRounds;
+};
+
+}
@@ -7,26 +7,35 @@ class DAergicModulator;
 class EventProcessor;
 class SynapticTransmissionStats;
 class CycleOutputBuffer;
+class PhaseTimers;
+class EventLoadStats;
 
 struct StaticContext {
     StaticContext(
             EventProcessor& eventProcessor,
-            DAergicModulator& dopaminergicModulator,
+            DAergicModulator* dopaminergicModulator,
             const Population& population,
             CycleOutputBuffer& cycleOutputBuffer,
-            SynapticTransmissionStats& synapticTransmissionStats) noexcept :
+            SynapticTransmissionStats& synapticTransmissionStats,
+            PhaseTimers& phaseTimers,
+            EventLoadStats& eventLoadStats) noexcept :
             eventProcessor(eventProcessor),
             dopaminergicModulator(dopaminergicModulator),
             population(population),
             cycleOutputBuffer(cycleOutputBuffer),
-            synapticTransmissionStats(synapticTransmissionStats) {
+            synapticTransmissionStats(synapticTransmissionStats),
+            phaseTimers(phaseTimers),
+            eventLoadStats(eventLoadStats) {
     }
 
     EventProcessor& eventProcessor;
-    DAergicModulator& dopaminergicModulator;
+    // null in inference mode
+    DAergicModulator* dopaminergicModulator;
     const Population& population;
     CycleOutputBuffer& cycleOutputBuffer;
     SynapticTransmissionStats& synapticTransmissionStats;
+    PhaseTimers& phaseTimers;
+    EventLoadStats& eventLoadStats;
 };
 
 }
@@ -1,13 +1,71 @@
 #include "StaticInputSimulation.hpp"
 #include <memory>
+#include <algorithm>
+#include <tuple>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <csignal>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <plog/Log.h>
 #include "CommonEvent.hpp"
 #include "CycleController.hpp"
+#include "PartitionSynchronizer.hpp"
+#include "PerfCounters.hpp"
+#include "PopulationPartition.hpp"
+#include "Recordings.hpp"
+#include "SpikeExchange.hpp"
+#include "SynapticTransmissionStats.hpp"
 
 namespace soft_npu {
 
+static SizeType getNumPartitions(const ParamsType& params) {
+    auto it = params["simulation"].find("numPartitions");
+    SizeType numPartitions = it != params["simulation"].end() ? it->get<SizeType>() : 1;
+
+    if (numPartitions == 0) {
+        throw std::runtime_error("Number of partitions must be positive");
+    }
+
+    if (numPartitions > 1) {
+        for (const auto& sectionName : {"weightRecorder", "firingRateMonitor"}) {
+            if (params.find(sectionName) != params.end()) {
+                throw std::runtime_error(std::string("Partitions cannot be used with ") + sectionName);
+            }
+        }
+
+        // partitions are generated without relocation, so the ordering would silently not apply
+        if (params["simulation"].find("neuronOrdering") != params["simulation"].end()) {
+            throw std::runtime_error("Partitions cannot be used with a neuron ordering");
+        }
+
+        // a negative dopamine rate makes the release depend on the order of the eligibility traces of all partitions
+        if (params["dopaminergicModulator"]["releaseBaseRate"].get<ValueType>() < 0) {
+            throw std::runtime_error("Partitions cannot be used with a negative dopamine release base rate");
+        }
+    }
+
+    if (numPartitions > 1 && params.find("quantizedInference") != params.end()) {
+        throw std::runtime_error("Partitions cannot be used with quantizedInference");
+    }
+
+    if (numPartitions > 1 && params.find("clockDrivenInference") != params.end()) {
+        throw std::runtime_error("Partitions cannot be used with clockDrivenInference");
+    }
+
+    return numPartitions;
+}
+
 StaticInputSimulation::StaticInputSimulation(
         std::shared_ptr<const ParamsType> params) :
-            AbstractSimulation(params) {
+            AbstractSimulation(params),
+            numPartitions(getNumPartitions(*params)) {
+}
+
+SimulationResult StaticInputSimulation::run() {
+    return numPartitions > 1 ? runPartitioned() : AbstractSimulation::run();
 }
 
 void StaticInputSimulation::runController(
@@ -15,10 +73,27 @@ void StaticInputSimulation::runController(
         Population&,
         TimeType simulationTime,
         SynapticTransmissionStats&) {
+
+    const auto& cycleOutputBuffer = controller.getCycleOutputBuffer();
+
+    runCycles(controller, simulationTime, [&cycleOutputBuffer, this](TimeType currentTime) {
+        std::for_each(
+                cycleOutputBuffer.cbeginSpikingChannelIds(),
+                cycleOutputBuffer.cendSpikingChannelIds(),
+                [currentTime, this](SizeType channelId) {
+
+                    if (outChannelIdsToRecord.find(channelId) != outChannelIdsToRecord.end()) {
+                        recordedOutputChannelSpikes.emplace_back(currentTime, channelId);
+                    }
+                });
+    });
+}
+
+template<typename F>
+void StaticInputSimulation::runCycles(CycleController& controller, TimeType simulationTime, F afterCycle) {
     TimeType currentTime;
 
     auto& cycleInputBuffer = controller.getCycleInputBuffer();
-    const auto& cycleOutputBuffer = controller.getCycleOutputBuffer();
 
     while ((currentTime = controller.getTime()) <  simulationTime) {
 
@@ -33,16 +108,594 @@ void StaticInputSimulation::runController(
 
         controller.runCycle();
 
-        std::for_each(
-                cycleOutputBuffer.cbeginSpikingChannelIds(),
-                cycleOutputBuffer.cendSpikingChannelIds(),
-                [currentTime, this](SizeType channelId) {
+        afterCycle(currentTime);
+    }
+}
 
-                    if (outChannelIdsToRecord.find(channelId) != outChannelIdsToRecord.end()) {
-                        recordedOutputChannelSpikes.emplace_back(currentTime, channelId);
+namespace {
+
+// spikes of all partitions are exchanged in rounds of at most this many spikes
+constexpr SizeType spikeExchangeCapacityPerRound = 4096;
+
+// a synapse is identified by its pre-synaptic neuron and its index among the outbound synapses of that neuron
+struct IndexedSynapseInfo {
+    SizeType synapseIndex;
+    SynapseInfo synapseInfo;
+};
+
+struct PartitionResult {
+    SizeType numEventsProcessed = 0;
+    SizeType numSynapticTransmissions = 0;
+
+    // of all partitions, only sent by the first partition
+    std::vector<NeuronSpikeInfo> spikes;
+
+    std::vector<NeuronInfo> neuronInfos;
+    std::vector<Population::Location> locations;
+    std::vector<IndexedSynapseInfo> synapseInfos;
+    std::vector<VoltageRecording> voltageRecordings;
+    std::vector<PartitionSynchronizer::OutputChannelSpike> outputChannelSpikes;
+
+    double wallTimeEventProcessor = 0;
+    std::vector<PhaseWallTime> phaseWallTimes;
+    std::vector<PhasePerfCounts> phasePerfCounts;
+    EventLoadStats eventLoadStats{0};
+};
+
+class ResultBuffer {
+public:
+    template<typename T>
+    void put(const T& value) {
+        auto bytes = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    template<typename T>
+    T get() {
+        if (readPosition + sizeof(T) > buffer.size()) {
+            throw std::runtime_error("Truncated partition result");
+        }
+
+        T value;
+        std::memcpy(&value, buffer.data() + readPosition, sizeof(T));
+        readPosition += sizeof(T);
+        return value;
+    }
+
+    void putString(const std::string& value) {
+        put(value.size());
+        buffer.insert(buffer.end(), value.cbegin(), value.cend());
+    }
+
+    std::string getString() {
+        auto size = get<SizeType>();
+
+        if (readPosition + size > buffer.size()) {
+            throw std::runtime_error("Truncated partition result");
+        }
+
+        std::string value(buffer.data() + readPosition, size);
+        readPosition += size;
+        return value;
+    }
+
+    std::vector<char> buffer;
+
+private:
+    SizeType readPosition = 0;
+};
+
+void writeAll(int fileDescriptor, const std::vector<char>& buffer) {
+    SizeType numBytesWritten = 0;
+
+    while (numBytesWritten < buffer.size()) {
+        auto result = write(fileDescriptor, buffer.data() + numBytesWritten, buffer.size() - numBytesWritten);
+
+        if (result < 0 && errno != EINTR) {
+            throw std::runtime_error("Could not write partition result");
+        } else if (result > 0) {
+            numBytesWritten += result;
+        }
+    }
+}
+
+ResultBuffer serializePartitionResult(const PartitionResult& partitionResult) {
+    ResultBuffer resultBuffer;
+
+    resultBuffer.put(partitionResult.numEventsProcessed);
+    resultBuffer.put(partitionResult.numSynapticTransmissions);
+
+    resultBuffer.put(partitionResult.spikes.size());
+    for (const auto& spikeInfo : partitionResult.spikes) {
+        resultBuffer.put(spikeInfo.time);
+        resultBuffer.put(spikeInfo.neuronId);
+    }
+
+    resultBuffer.put(partitionResult.neuronInfos.size());
+    for (SizeType i = 0; i < partitionResult.neuronInfos.size(); ++i) {
+        resultBuffer.put(partitionResult.neuronInfos[i].neuronId);
+        resultBuffer.put(partitionResult.neuronInfos[i].isInhibitory);
+        resultBuffer.put(partitionResult.locations[i]);
+    }
+
+    resultBuffer.put(partitionResult.synapseInfos.size());
+    for (const auto& indexedSynapseInfo : partitionResult.synapseInfos) {
+        const auto& synapseInfo = indexedSynapseInfo.synapseInfo;
+        resultBuffer.put(indexedSynapseInfo.synapseIndex);
+        resultBuffer.put(synapseInfo.preSynapticNeuronId);
+        resultBuffer.put(synapseInfo.postSynapticNeuronId);
+        resultBuffer.put(synapseInfo.weight);
+        resultBuffer.put(synapseInfo.isInhibitory);
+    }
+
+    resultBuffer.put(partitionResult.voltageRecordings.size());
+    for (const auto& voltageRecording : partitionResult.voltageRecordings) {
+        resultBuffer.put(voltageRecording.neuronId);
+        resultBuffer.put(voltageRecording.time);
+        resultBuffer.put(voltageRecording.voltage);
+    }
+
+    resultBuffer.put(partitionResult.outputChannelSpikes.size());
+    for (const auto& outputChannelSpike : partitionResult.outputChannelSpikes) {
+        resultBuffer.put(outputChannelSpike);
+    }
+
+    resultBuffer.put(partitionResult.wallTimeEventProcessor);
+
+    resultBuffer.put(partitionResult.phaseWallTimes.size());
+    for (const auto& phaseWallTime : partitionResult.phaseWallTimes) {
+        resultBuffer.putString(phaseWallTime.phaseName);
+        resultBuffer.put(phaseWallTime.wallTime);
+    }
+
+    resultBuffer.put(partitionResult.phasePerfCounts.size());
+    for (const auto& phasePerfCounts : partitionResult.phasePerfCounts) {
+        resultBuffer.putString(phasePerfCounts.phaseName);
+        resultBuffer.put(phasePerfCounts.counts);
+    }
+
+    const auto& eventLoadStats = partitionResult.eventLoadStats;
+    for (SizeType queue = 0; queue < static_cast<SizeType>(EventQueue::numQueues); ++queue) {
+        resultBuffer.put(eventLoadStats.getQueueLoadStats(static_cast<EventQueue>(queue)));
+    }
+
+    resultBuffer.put(eventLoadStats.getSamples().size());
+    for (const auto& eventLoadSample : eventLoadStats.getSamples()) {
+        resultBuffer.put(eventLoadSample);
+    }
+
+    return resultBuffer;
+}
+
+PartitionResult deserializePartitionResult(ResultBuffer& resultBuffer) {
+    PartitionResult partitionResult;
+
+    partitionResult.numEventsProcessed = resultBuffer.get<SizeType>();
+    partitionResult.numSynapticTransmissions = resultBuffer.get<SizeType>();
+
+    for (auto numSpikes = resultBuffer.get<SizeType>(); numSpikes > 0; --numSpikes) {
+        auto time = resultBuffer.get<TimeType>();
+        partitionResult.spikes.emplace_back(time, resultBuffer.get<SizeType>());
+    }
+
+    for (auto numNeurons = resultBuffer.get<SizeType>(); numNeurons > 0; --numNeurons) {
+        auto neuronId = resultBuffer.get<SizeType>();
+        partitionResult.neuronInfos.emplace_back(neuronId, resultBuffer.get<bool>());
+        partitionResult.locations.push_back(resultBuffer.get<Population::Location>());
+    }
+
+    for (auto numSynapses = resultBuffer.get<SizeType>(); numSynapses > 0; --numSynapses) {
+        auto synapseIndex = resultBuffer.get<SizeType>();
+        auto preSynapticNeuronId = resultBuffer.get<SizeType>();
+        auto postSynapticNeuronId = resultBuffer.get<SizeType>();
+        auto weight = resultBuffer.get<ValueType>();
+        partitionResult.synapseInfos.push_back({synapseIndex, SynapseInfo(
+                preSynapticNeuronId, postSynapticNeuronId, weight, resultBuffer.get<bool>())});
+    }
+
+    for (auto numVoltageRecordings = resultBuffer.get<SizeType>(); numVoltageRecordings > 0; --numVoltageRecordings) {
+        auto neuronId = resultBuffer.get<SizeType>();
+        auto time = resultBuffer.get<TimeType>();
+        partitionResult.voltageRecordings.emplace_back(neuronId, time, resultBuffer.get<ValueType>());
+    }
+
+    for (auto numChannelSpikes = resultBuffer.get<SizeType>(); numChannelSpikes > 0; --numChannelSpikes) {
+        partitionResult.outputChannelSpikes.push_back(resultBuffer.get<PartitionSynchronizer::OutputChannelSpike>());
+    }
+
+    partitionResult.wallTimeEventProcessor = resultBuffer.get<double>();
+
+    for (auto numPhases = resultBuffer.get<SizeType>(); numPhases > 0; --numPhases) {
+        auto phaseName = resultBuffer.getString();
+        partitionResult.phaseWallTimes.push_back({std::move(phaseName), resultBuffer.get<double>()});
+    }
+
+    for (auto numPhases = resultBuffer.get<SizeType>(); numPhases > 0; --numPhases) {
+        auto phaseName = resultBuffer.getString();
+        partitionResult.phasePerfCounts.push_back({std::move(phaseName), resultBuffer.get<PerfCounts>()});
+    }
+
+    std::array<QueueLoadStats, static_cast<SizeType>(EventQueue::numQueues)> queueLoadStats;
+    for (auto& stats : queueLoadStats) {
+        stats = resultBuffer.get<QueueLoadStats>();
+    }
+
+    std::vector<EventLoadSample> eventLoadSamples;
+    for (auto numSamples = resultBuffer.get<SizeType>(); numSamples > 0; --numSamples) {
+        eventLoadSamples.push_back(resultBuffer.get<EventLoadSample>());
+    }
+
+    partitionResult.eventLoadStats = EventLoadStats(queueLoadStats, std::move(eventLoadSamples));
+
+    return partitionResult;
+}
+
+// merges recordings sorted by time; at equal times, earlier partitions go first
+template<typename T, typename G>
+std::vector<T> mergeByTime(const std::vector<PartitionResult>& partitionResults, G getRecords) {
+    std::vector<T> merged;
+    std::vector<SizeType> positions(partitionResults.size());
+
+    while (true) {
+        auto next = partitionResults.size();
+
+        for (SizeType i = 0; i < partitionResults.size(); ++i) {
+            const auto& records = getRecords(partitionResults[i]);
+
+            if (positions[i] < records.size() &&
+                    (next == partitionResults.size() ||
+                    records[positions[i]].time < getRecords(partitionResults[next])[positions[next]].time)) {
+                next = i;
+            }
+        }
+
+        if (next == partitionResults.size()) {
+            return merged;
+        }
+
+        merged.push_back(getRecords(partitionResults[next])[positions[next]++]);
+    }
+}
+
+void terminateChildProcesses(const std::vector<pid_t>& pids) {
+    for (auto pid : pids) {
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+    }
+}
+
+template<typename T>
+double convertToSecondsTime(const T& val) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(val).count() * 1e-6;
+}
+
+}
+
+SimulationResult StaticInputSimulation::runPartitioned() {
+
+    if (isVoltageProbeEnabled()) {
+        throw std::runtime_error("Voltage probes cannot be used with partitions");
+    }
+
+    // a negative dopamine rate makes the release depend on the order of the eligibility traces of all partitions
+    for (const auto& rewardDose : rewardDoses) {
+        if (rewardDose.dosage < 0) {
+            throw std::runtime_error("Negative reward doses cannot be used with partitions");
+        }
+    }
+
+    auto startTs = std::chrono::high_resolution_clock::now();
+
+    TimeType simulationTime = (*params)["simulation"]["untilTime"];
+    TimeType dt = (*params)["cycleController"]["dt"];
+
+    SpikeExchange spikeExchange(numPartitions, spikeExchangeCapacityPerRound);
+
+    PLOG_DEBUG << "Running " << numPartitions << " partitions";
+
+    std::vector<pid_t> pids;
+    std::vector<int> resultFileDescriptors;
+
+    for (SizeType partitionId = 0; partitionId < numPartitions; ++partitionId) {
+        int fileDescriptors[2];
+
+        if (pipe(fileDescriptors) != 0) {
+            terminateChildProcesses(pids);
+            throw std::runtime_error("Could not create pipe for partition result");
+        }
+
+        auto pid = fork();
+
+        if (pid < 0) {
+            terminateChildProcesses(pids);
+            throw std::runtime_error("Could not fork partition process");
+        } else if (pid == 0) {
+            close(fileDescriptors[0]);
+            int exitCode = 0;
+
+            try {
+                runPartition(partitionId, spikeExchange, fileDescriptors[1]);
+            } catch (const std::exception& e) {
+                PLOG_ERROR << "Partition " << partitionId << " failed: " << e.what();
+                exitCode = 1;
+            }
+
+            _exit(exitCode);
+        }
+
+        close(fileDescriptors[1]);
+        pids.push_back(pid);
+        resultFileDescriptors.push_back(fileDescriptors[0]);
+    }
+
+    // results are read from all pipes concurrently; a failed partition would leave the others waiting at the
+    // spike exchange, so they are terminated
+    std::vector<ResultBuffer> resultBuffers(numPartitions);
+    std::vector<pollfd> pollFileDescriptors;
+
+    for (auto fileDescriptor : resultFileDescriptors) {
+        pollFileDescriptors.push_back({fileDescriptor, POLLIN, 0});
+    }
+
+    SizeType numOpenPipes = numPartitions;
+    std::vector<char> chunk(1 << 16);
+
+    while (numOpenPipes > 0) {
+        if (poll(pollFileDescriptors.data(), pollFileDescriptors.size(), -1) < 0) {
+            // revents are undefined after a failed poll
+            if (errno == EINTR) {
+                continue;
+            }
+
+            auto pollErrno = errno;
+            terminateChildProcesses(pids);
+            throw std::runtime_error(std::string("Could not poll partition results: ") + std::strerror(pollErrno));
+        }
+
+        for (SizeType partitionId = 0; partitionId < numPartitions; ++partitionId) {
+            auto& pollFileDescriptor = pollFileDescriptors[partitionId];
+
+            if (pollFileDescriptor.fd < 0 || pollFileDescriptor.revents == 0) {
+                continue;
+            }
+
+            auto numBytesRead = read(pollFileDescriptor.fd, chunk.data(), chunk.size());
+
+            if (numBytesRead > 0) {
+                auto& buffer = resultBuffers[partitionId].buffer;
+                buffer.insert(buffer.end(), chunk.cbegin(), chunk.cbegin() + numBytesRead);
+            } else if (numBytesRead == 0 || errno != EINTR) {
+                close(pollFileDescriptor.fd);
+                pollFileDescriptor.fd = -1;
+                -- numOpenPipes;
+
+                int status;
+                waitpid(pids[partitionId], &status, 0);
+                pids[partitionId] = -1;
+
+                if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                    for (auto& otherPollFileDescriptor : pollFileDescriptors) {
+                        if (otherPollFileDescriptor.fd >= 0) {
+                            close(otherPollFileDescriptor.fd);
+                        }
                     }
-                });
+
+                    pids.erase(std::remove(pids.begin(), pids.end(), -1), pids.end());
+                    terminateChildProcesses(pids);
+                    throw std::runtime_error("Partition process " + std::to_string(partitionId) + " failed");
+                }
+            }
+        }
+    }
+
+    std::vector<PartitionResult> partitionResults;
+    SizeType numEventsProcessed = 0;
+    SizeType numSynapticTransmissions = 0;
+    std::vector<NeuronInfo> neuronInfos;
+    std::vector<Population::Location> locationsIndexedByNeuronId;
+    std::vector<IndexedSynapseInfo> indexedSynapseInfos;
+    std::vector<PartitionSynchronizer::OutputChannelSpike> outputChannelSpikes;
+    double wallTimeEventProcessor = 0;
+    std::vector<PhaseWallTime> phaseWallTimes;
+    std::vector<PhasePerfCounts> phasePerfCounts;
+    EventLoadStats eventLoadStats(0);
+
+    // partitions are contiguous ranges of neuron ids
+    for (auto& resultBuffer : resultBuffers) {
+        partitionResults.push_back(deserializePartitionResult(resultBuffer));
+        const auto& partitionResult = partitionResults.back();
+
+        numEventsProcessed += partitionResult.numEventsProcessed;
+        numSynapticTransmissions += partitionResult.numSynapticTransmissions;
+        std::copy(
+                partitionResult.neuronInfos.cbegin(),
+                partitionResult.neuronInfos.cend(),
+                std::back_inserter(neuronInfos));
+        locationsIndexedByNeuronId.insert(
+                locationsIndexedByNeuronId.end(), partitionResult.locations.cbegin(), partitionResult.locations.cend());
+        indexedSynapseInfos.insert(
+                indexedSynapseInfos.end(), partitionResult.synapseInfos.cbegin(), partitionResult.synapseInfos.cend());
+        outputChannelSpikes.insert(
+                outputChannelSpikes.end(), partitionResult.outputChannelSpikes.cbegin(), partitionResult.outputChannelSpikes.cend());
+
+        // partitions run concurrently, so wall times are those of the slowest partition while hardware counts add up
+        wallTimeEventProcessor = std::max(wallTimeEventProcessor, partitionResult.wallTimeEventProcessor);
+
+        if (phaseWallTimes.empty()) {
+            phaseWallTimes = partitionResult.phaseWallTimes;
+        } else {
+            for (SizeType phase = 0; phase < phaseWallTimes.size(); ++phase) {
+                phaseWallTimes[phase].wallTime = std::max(
+                        phaseWallTimes[phase].wallTime, partitionResult.phaseWallTimes[phase].wallTime);
+            }
+        }
+
+        if (phasePerfCounts.empty()) {
+            phasePerfCounts = partitionResult.phasePerfCounts;
+        } else {
+            for (SizeType phase = 0; phase < phasePerfCounts.size() && phase < partitionResult.phasePerfCounts.size(); ++phase) {
+                phasePerfCounts[phase].counts += partitionResult.phasePerfCounts[phase].counts;
+            }
+        }
+
+        eventLoadStats.merge(partitionResult.eventLoadStats);
     }
+
+    // the order of the outbound synapses of each neuron in the full population
+    std::sort(indexedSynapseInfos.begin(), indexedSynapseInfos.end(), [](const auto& lhs, const auto& rhs) {
+        return std::tie(lhs.synapseInfo.preSynapticNeuronId, lhs.synapseIndex) <
+               std::tie(rhs.synapseInfo.preSynapticNeuronId, rhs.synapseIndex);
+    });
+
+    std::vector<SynapseInfo> synapseInfos;
+    std::transform(
+            indexedSynapseInfos.cbegin(),
+            indexedSynapseInfos.cend(),
+            std::back_inserter(synapseInfos),
+            [](const auto& indexedSynapseInfo) {
+                return indexedSynapseInfo.synapseInfo;
+            });
+
+    // the spike of one neuron projects to its output channels in projector order
+    std::stable_sort(outputChannelSpikes.begin(), outputChannelSpikes.end(), [](const auto& lhs, const auto& rhs) {
+        return std::tie(lhs.cycleId, lhs.spikeRank) < std::tie(rhs.cycleId, rhs.spikeRank);
+    });
+
+    for (const auto& outputChannelSpike : outputChannelSpikes) {
+        recordedOutputChannelSpikes.emplace_back(dt * outputChannelSpike.cycleId, outputChannelSpike.channelId);
+    }
+
+    auto& spikes = partitionResults.front().spikes;
+    SizeType numExcitatorySpikes = 0;
+    SizeType numInhibitorySpikes = 0;
+
+    for (const auto& spikeInfo : spikes) {
+        if (neuronInfos[spikeInfo.neuronId].isInhibitory) {
+            ++ numInhibitorySpikes;
+        } else {
+            ++ numExcitatorySpikes;
+        }
+    }
+
+    SizeType numInhibitoryNeurons = std::count_if(neuronInfos.cbegin(), neuronInfos.cend(), [](const auto& neuronInfo) {
+        return neuronInfo.isInhibitory;
+    });
+    auto numExcitatoryNeurons = neuronInfos.size() - numInhibitoryNeurons;
+
+    auto meanExcitatoryFiringRate = numExcitatoryNeurons == 0 ? 0 : numExcitatorySpikes / simulationTime / numExcitatoryNeurons;
+    auto meanInhibitoryFiringRate = numInhibitoryNeurons == 0 ? 0 : numInhibitorySpikes / simulationTime / numInhibitoryNeurons;
+
+    auto voltageRecordings = mergeByTime<VoltageRecording>(partitionResults, [](const auto& partitionResult) -> const auto& {
+        return partitionResult.voltageRecordings;
+    });
+
+    auto wallTimeTotal = convertToSecondsTime(std::chrono::high_resolution_clock::now() - startTs);
+
+    return SimulationResult(
+            simulationTime,
+            std::move(spikes),
+            std::move(voltageRecordings),
+            VoltageSamples(),
+            std::move(neuronInfos),
+            std::move(synapseInfos),
+            std::move(locationsIndexedByNeuronId),
+            numExcitatorySpikes,
+            numInhibitorySpikes,
+            numSynapticTransmissions,
+            meanExcitatoryFiringRate,
+            meanInhibitoryFiringRate,
+            wallTimeTotal,
+            wallTimeEventProcessor,
+            numEventsProcessed,
+            std::move(phaseWallTimes),
+            std::move(phasePerfCounts),
+            std::move(eventLoadStats));
+}
+
+void StaticInputSimulation::runPartition(SizeType partitionId, SpikeExchange& spikeExchange, int resultFileDescriptor) {
+
+    TimeType simulationTime = (*params)["simulation"]["untilTime"];
+
+    PhasePerfCounts populationGenerationPerfCounts{"population generation", {}};
+    std::unique_ptr<PopulationPartition> partition;
+
+    {
+        ScopedPerfCounts scopedPerfCounts(populationGenerationPerfCounts.counts);
+        partition = populationGenerator->generatePartition(numPartitions, partitionId);
+    }
+
+    auto startTsEventProcessor = std::chrono::high_resolution_clock::now();
+
+    auto& population = partition->getPopulation();
+    SynapticTransmissionStats synapticTransmissionStats;
+
+    CycleController controller(
+            *params,
+            population,
+            false,
+            neuronIdTimePairsToRecordVoltageAt,
+            synapticTransmissionStats);
+
+    PartitionSynchronizer partitionSynchronizer(
+            *partition,
+            spikeExchange,
+            controller,
+            synapticTransmissionStats,
+            (*params)["eventProcessor"]["lookAheadWindow"]);
+
+    controller.setPartitionSynchronizer(partitionSynchronizer);
+
+    runCycles(controller, simulationTime, [](TimeType) {});
+    partitionSynchronizer.finish();
+
+    PartitionResult partitionResult;
+
+    partitionResult.wallTimeEventProcessor = convertToSecondsTime(
+            std::chrono::high_resolution_clock::now() - startTsEventProcessor);
+    partitionResult.phaseWallTimes = controller.getPhaseTimers().getPhaseWallTimes();
+    partitionResult.phasePerfCounts = controller.getPhaseTimers().getPhasePerfCounts();
+    if (!partitionResult.phasePerfCounts.empty()) {
+        populationGenerationPerfCounts.counts = populationGenerationPerfCounts.counts.getScaled();
+        partitionResult.phasePerfCounts.insert(partitionResult.phasePerfCounts.begin(), populationGenerationPerfCounts);
+    }
+    partitionResult.eventLoadStats = controller.getEventLoadStats();
+
+    const auto& voltageRecordings = controller.getRecordings()->voltageRecordings;
+
+    partitionResult.numEventsProcessed = controller.getNumEventsProcessed();
+    partitionResult.numSynapticTransmissions = synapticTransmissionStats.getTransmissionCount();
+    std::copy(
+            partitionSynchronizer.getSpikes().cbegin(),
+            partitionSynchronizer.getSpikes().cend(),
+            std::back_inserter(partitionResult.spikes));
+    std::copy(voltageRecordings.cbegin(), voltageRecordings.cend(), std::back_inserter(partitionResult.voltageRecordings));
+
+    for (const auto& outputChannelSpike : partitionSynchronizer.getOutputChannelSpikes()) {
+        if (outChannelIdsToRecord.find(outputChannelSpike.channelId) != outChannelIdsToRecord.end()) {
+            partitionResult.outputChannelSpikes.push_back(outputChannelSpike);
+        }
+    }
+
+    for (SizeType neuronId = 0; neuronId < population.getPopulationSize(); ++neuronId) {
+        if (partition->isLocal(neuronId)) {
+            const auto& neuron = population.getNeuronById(neuronId);
+            partitionResult.neuronInfos.emplace_back(neuronId, neuron.getNeuronParams()->isInhibitory);
+            partitionResult.locations.push_back(population.getCellLocation(neuronId));
+        }
+
+        for (const auto& inboundSynapse : partition->getInboundSynapses(neuronId)) {
+            const auto& synapse = *inboundSynapse.synapse;
+
+            partitionResult.synapseInfos.push_back({inboundSynapse.synapseIndex, SynapseInfo(
+                    neuronId,
+                    synapse.postSynapticNeuron->getNeuronId(),
+                    synapse.weight,
+                    partition->isInhibitory(neuronId))});
+        }
+    }
+
+    writeAll(resultFileDescriptor, serializePartitionResult(partitionResult).buffer);
+    close(resultFileDescriptor);
 }
 
 void StaticInputSimulation::recordOutputChannel(SizeType channelId) {
@@ -11,6 +11,8 @@
 
 namespace soft_npu {
 
+class SpikeExchange;
+
 class StaticInputSimulation : public AbstractSimulation {
 public:
     explicit StaticInputSimulation(std::shared_ptr<const ParamsType> params);
@@ -21,6 +23,11 @@ public:
     void recordOutputChannel(SizeType channelId);
     std::vector<ChannelSpikeInfo> getRecordedOutputChannelSpikes() const;
 
+    // with simulation.numPartitions > 1, every partition of the population is generated and simulated by a forked
+    // process, see PartitionSynchronizer; the result equals the single process one, except for the phase timers and
+    // event load stats, which are not collected
+    SimulationResult run() override;
+
     void runController(
             CycleController& controller,
             Population& population,
@@ -28,6 +35,13 @@ public:
             SynapticTransmissionStats&) override;
 
 private:
+    template<typename F>
+    void runCycles(CycleController& controller, TimeType simulationTime, F afterCycle);
+
+    SimulationResult runPartitioned();
+    void runPartition(SizeType partitionId, SpikeExchange& spikeExchange, int resultFileDescriptor);
+
+    SizeType numPartitions;
     std::deque<ChannelSpikeInfo> spikeTrains;
     std::deque<RewardDoseInfo> rewardDoses;
     std::unordered_set<SizeType> outChannelIdsToRecord;
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+#include <Aliases.hpp>
+
+namespace soft_npu {
+
+// FIFO ring for time-ordered entries. Expired entries are evicted from the front on insertion; the capacity
+// only grows when the live window does not fit, so memory is bounded by the peak number of live entries. Without an
+// initial capacity, nothing is allocated until the first insertion. T must be default constructible.
+template<typename T>
+class TimeWindowedRingBuffer {
+
+public:
+
+    explicit TimeWindowedRingBuffer(SizeType initialCapacity = 0) :
+        buffer(initialCapacity == 0 ? 0 : getPowerOfTwoCapacity(initialCapacity)), head(0), numElements(0) {
+    }
+
+    template<typename IsExpired, typename... Args>
+    void evictAndEmplace(IsExpired isExpired, Args&&... args) {
+        evictExpired(isExpired);
+
+        if (numElements == buffer.size()) {
+            grow();
+        }
+
+        buffer[(head + numElements) & (buffer.size() - 1)] = T(std::forward<Args>(args)...);
+        ++ numElements;
+    }
+
+    template<typename IsExpired>
+    void evictExpired(IsExpired isExpired) {
+        while (numElements > 0 && isExpired(buffer[head])) {
+            head = (head + 1) & (buffer.size() - 1);
+            -- numElements;
+        }
+    }
+
+    template<typename F>
+    void forEach(F f) const {
+        for (SizeType i = 0; i < numElements; ++i) {
+            f(buffer[(head + i) & (buffer.size() - 1)]);
+        }
+    }
+
+    void clear() noexcept {
+        head = 0;
+        numElements = 0;
+    }
+
+    SizeType size() const noexcept {
+        return numElements;
+    }
+
+    SizeType capacity() const noexcept {
+        return buffer.size();
+    }
+
+private:
+    std::vector<T> buffer;
+    SizeType head;
+    SizeType numElements;
+
+    static SizeType getPowerOfTwoCapacity(SizeType minCapacity) {
+        SizeType capacity = 1;
+
+        while (capacity < minCapacity) {
+            capacity *= 2;
+        }
+
+        return capacity;
+    }
+
+    void grow() {
+        std::vector<T> grownBuffer(buffer.empty() ? 1 : buffer.size() * 2);
+
+        for (SizeType i = 0; i < numElements; ++i) {
+            grownBuffer[i] = std::move(buffer[(head + i) & (buffer.size() - 1)]);
+        }
+
+        buffer.swap(grownBuffer);
+        head = 0;
+    }
+};
+
+}
@@ -15,6 +15,7 @@ public:
     TransmissionEvent(ValueType unscaledEpsp, Synapse *synapse, Neuron &targetNeuron) :
         targetNeuron(targetNeuron), synapse(synapse), unscaledEpsp(unscaledEpsp) {}
 
+    template<bool isPlastic = true>
     void process(const CycleContext &cycleContext) const {
 
         ValueType scaledEpsp = unscaledEpsp;
@@ -31,13 +32,23 @@ public:
                 synapse->shortTermPlasticityState.onTransmission(cycleContext, *synapse->synapseParams);
             }
 
-            targetNeuron.registerInboundSynapticTransmission(cycleContext, synapse);
-            synapse->handleSTDP(cycleContext, targetNeuron.getLastSpikeTime(), cycleContext.time);
+            if constexpr (isPlastic) {
+                targetNeuron.registerInboundSynapticTransmission(cycleContext, synapse);
+                synapse->handleSTDP(cycleContext, targetNeuron.getLastSpikeTime(), cycleContext.time);
+            }
         }
 
         targetNeuron.produceEPSP(cycleContext, cycleContext.time, scaledEpsp);
     }
 
+    ValueType getUnscaledEpsp() const noexcept {
+        return unscaledEpsp;
+    }
+
+    const Neuron& getTargetNeuron() const noexcept {
+        return targetNeuron;
+    }
+
 private:
     Neuron& targetNeuron;
     Synapse* synapse;
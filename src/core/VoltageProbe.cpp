@@ -0,0 +1,105 @@
+#include "VoltageProbe.hpp"
+#include <neuro/Population.hpp>
+#include <cstdint>
+#include <stdexcept>
+
+namespace soft_npu {
+
+VoltageProbe::VoltageProbe() noexcept :
+        sampleIntervalNumCycles(0),
+        nextSampleCycleId(0),
+        maxNumBufferedRows(0),
+        numFlushedRows(0) {
+}
+
+template<typename T>
+static void writeValue(std::ofstream& os, T value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+VoltageProbe::VoltageProbe(
+        const Population& population,
+        std::vector<SizeType> neuronIds,
+        SizeType sampleIntervalNumCycles,
+        SizeType maxNumBufferedRows,
+        const std::string& flushFilePath) :
+        sampleIntervalNumCycles(sampleIntervalNumCycles),
+        nextSampleCycleId(0),
+        maxNumBufferedRows(maxNumBufferedRows),
+        numFlushedRows(0) {
+
+    if (sampleIntervalNumCycles == 0 || maxNumBufferedRows == 0) {
+        throw std::runtime_error("Voltage probe requires a positive sample interval and buffer size");
+    }
+
+    for (auto neuronId : neuronIds) {
+        neurons.push_back(&population.getNeuronById(neuronId));
+    }
+
+    samples.neuronIds = std::move(neuronIds);
+    samples.times.reserve(maxNumBufferedRows);
+    samples.voltages.reserve(maxNumBufferedRows * samples.neuronIds.size());
+
+    if (!flushFilePath.empty()) {
+        flushFile.open(flushFilePath, std::ios::binary);
+
+        if (!flushFile) {
+            throw std::runtime_error("Unable to open file: " + flushFilePath);
+        }
+
+        flushFile.write("SNPVOLT1", 8);
+        writeValue<uint64_t>(flushFile, samples.neuronIds.size());
+        writeValue<uint32_t>(flushFile, sizeof(ValueType));
+        writeValue<uint32_t>(flushFile, 0);
+
+        for (auto neuronId : samples.neuronIds) {
+            writeValue<uint64_t>(flushFile, neuronId);
+        }
+    }
+}
+
+void VoltageProbe::sample(TimeType time) {
+    samples.times.push_back(time);
+
+    for (auto neuron : neurons) {
+        samples.voltages.push_back(neuron->getMembraneVoltage(time));
+    }
+
+    if (samples.times.size() == maxNumBufferedRows && flushFile.is_open()) {
+        flush();
+    }
+}
+
+void VoltageProbe::flush() {
+    auto numColumns = samples.neuronIds.size();
+
+    for (SizeType row = 0; row < samples.times.size(); ++row) {
+        writeValue<double>(flushFile, samples.times[row]);
+        flushFile.write(
+                reinterpret_cast<const char*>(samples.voltages.data() + row * numColumns),
+                numColumns * sizeof(ValueType));
+    }
+
+    if (!flushFile) {
+        throw std::runtime_error("Unable to write voltage samples");
+    }
+
+    numFlushedRows += samples.times.size();
+    samples.times.clear();
+    samples.voltages.clear();
+}
+
+VoltageSamples VoltageProbe::finish() {
+    if (flushFile.is_open()) {
+        flush();
+        flushFile.close();
+    }
+
+    return std::move(samples);
+}
+
+SizeType VoltageProbe::getNumFlushedRows() const noexcept {
+    return numFlushedRows;
+}
+
+}
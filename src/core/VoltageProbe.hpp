@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include "VoltageSamples.hpp"
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace soft_npu {
+
+class Neuron;
+class Population;
+
+// Samples the membrane voltages of a neuron set at the end of every sampleIntervalNumCycles-th cycle, starting with
+// the first, in one pass into a preallocated row buffer. With a flush file, every maxNumBufferedRows rows are appended
+// to it, so memory stays bounded; otherwise all rows are kept. The file consists of
+//   char[8] "SNPVOLT1", uint64 number of neurons, uint32 bytes per voltage (4 or 8), uint32 0, uint64 neuron ids[]
+// followed by one row per sample: float64 time, voltages[]. All values are in native byte order.
+// A default constructed probe is disabled.
+class VoltageProbe {
+public:
+    VoltageProbe() noexcept;
+
+    VoltageProbe(
+            const Population& population,
+            std::vector<SizeType> neuronIds,
+            SizeType sampleIntervalNumCycles,
+            SizeType maxNumBufferedRows,
+            const std::string& flushFilePath);
+
+    bool isEnabled() const noexcept {
+        return sampleIntervalNumCycles > 0;
+    }
+
+    void onCycleEnd(SizeType cycleId, TimeType time) {
+        if (cycleId == nextSampleCycleId && isEnabled()) {
+            sample(time);
+            nextSampleCycleId += sampleIntervalNumCycles;
+        }
+    }
+
+    // flushes the remaining rows to the flush file if there is one, the returned samples hold the rows kept in memory
+    VoltageSamples finish();
+
+    SizeType getNumFlushedRows() const noexcept;
+
+private:
+    void sample(TimeType time);
+    void flush();
+
+    std::vector<const Neuron*> neurons;
+    SizeType sampleIntervalNumCycles;
+    SizeType nextSampleCycleId;
+    SizeType maxNumBufferedRows;
+    SizeType numFlushedRows;
+    VoltageSamples samples;
+    std::ofstream flushFile;
+};
+
+}
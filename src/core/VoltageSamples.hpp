@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <vector>
+
+namespace soft_npu {
+
+// membrane voltages of a fixed neuron set, one row per sample time and one column per neuron
+struct VoltageSamples {
+    std::vector<SizeType> neuronIds;
+    std::vector<TimeType> times;
+    // row-major
+    std::vector<ValueType> voltages;
+
+    ValueType getVoltage(SizeType row, SizeType column) const noexcept {
+        return voltages[row * neuronIds.size() + column];
+    }
+};
+
+}
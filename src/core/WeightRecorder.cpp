@@ -0,0 +1,133 @@
+#include "WeightRecorder.hpp"
+#include <neuro/Population.hpp>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace soft_npu {
+
+using WeightBitsType = std::conditional_t<sizeof(ValueType) == 4, uint32_t, uint64_t>;
+
+static constexpr SizeType flushBufferBytes = 1 << 20;
+
+static WeightBitsType getBits(ValueType weight) noexcept {
+    WeightBitsType bits;
+    std::memcpy(&bits, &weight, sizeof(bits));
+    return bits;
+}
+
+WeightRecorder::WeightRecorder() noexcept :
+        sampleIntervalNumCycles(0),
+        nextSampleCycleId(0),
+        numSnapshots(0),
+        numRecordedChanges(0) {
+}
+
+WeightRecorder::WeightRecorder(
+        const Population& population,
+        SizeType sampleIntervalNumCycles,
+        const std::string& filePath) :
+        sampleIntervalNumCycles(sampleIntervalNumCycles),
+        nextSampleCycleId(0),
+        numSnapshots(0),
+        numRecordedChanges(0),
+        file(filePath, std::ios::binary) {
+
+    if (sampleIntervalNumCycles == 0) {
+        throw std::runtime_error("Weight recorder requires a positive sample interval");
+    }
+
+    if (!file) {
+        throw std::runtime_error("Unable to open file: " + filePath);
+    }
+
+    for (auto it = population.cbeginNeurons(); it != population.cendNeurons(); ++it) {
+        if (!(*it)->getNeuronParams()->isInhibitory) {
+            for (auto synIt = (*it)->cbeginOutboundSynapses(); synIt != (*it)->cendOutboundSynapses(); ++synIt) {
+                synapses.push_back(*synIt);
+            }
+        }
+    }
+
+    recordedWeights.resize(synapses.size());
+
+    uint32_t header[] = {sizeof(ValueType), 0};
+    buffer.append("SNPWGHT1", 8);
+    buffer.append(reinterpret_cast<const char*>(header), sizeof(header));
+    writeVarint(synapses.size());
+
+    SizeType lastPreSynapticNeuronId = 0;
+
+    for (auto synapse : synapses) {
+        auto preSynapticNeuronId = synapse->preSynapticNeuron->getNeuronId();
+        writeVarint(preSynapticNeuronId - lastPreSynapticNeuronId);
+        writeVarint(synapse->postSynapticNeuron->getNeuronId());
+        lastPreSynapticNeuronId = preSynapticNeuronId;
+    }
+}
+
+void WeightRecorder::writeVarint(uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+
+    buffer.push_back(static_cast<char>(value));
+}
+
+void WeightRecorder::recordSnapshot(TimeType time) {
+    // the number of changes precedes them, so they are collected first
+    changedIndices.clear();
+
+    for (SizeType i = 0; i < synapses.size(); ++i) {
+        if (getBits(synapses[i]->weight) != getBits(recordedWeights[i])) {
+            changedIndices.push_back(i);
+        }
+    }
+
+    buffer.append(reinterpret_cast<const char*>(&time), sizeof(time));
+    writeVarint(changedIndices.size());
+
+    SizeType nextIndex = 0;
+
+    for (auto i : changedIndices) {
+        auto weight = synapses[i]->weight;
+        writeVarint(i + 1 - nextIndex);
+        writeVarint(getBits(weight) ^ getBits(recordedWeights[i]));
+        recordedWeights[i] = weight;
+        nextIndex = i + 1;
+    }
+
+    ++ numSnapshots;
+    numRecordedChanges += changedIndices.size();
+
+    if (buffer.size() >= flushBufferBytes) {
+        flush();
+    }
+}
+
+void WeightRecorder::flush() {
+    file.write(buffer.data(), buffer.size());
+    buffer.clear();
+
+    if (!file) {
+        throw std::runtime_error("Unable to write weight recording");
+    }
+}
+
+void WeightRecorder::finish() {
+    if (file.is_open()) {
+        flush();
+        file.close();
+    }
+}
+
+SizeType WeightRecorder::getNumSnapshots() const noexcept {
+    return numSnapshots;
+}
+
+SizeType WeightRecorder::getNumRecordedChanges() const noexcept {
+    return numRecordedChanges;
+}
+
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace soft_npu {
+
+struct Synapse;
+class Population;
+
+// Streams the weights of all excitatory synapses to a file at the end of every sampleIntervalNumCycles-th cycle,
+// starting with the first. Only the weights that changed since the previous snapshot are written, so memory is
+// bounded by one snapshot regardless of the run length. Unsigned varints are LEB128, all other values are in native
+// byte order. The file consists of
+//   char[8] "SNPWGHT1", uint32 bytes per weight (4 or 8), uint32 0, varint number of synapses,
+//   per synapse: varint pre-synaptic neuron id minus that of the previous synapse, varint post-synaptic neuron id,
+// followed by one record per snapshot:
+//   float64 time, varint number of changed weights,
+//   per changed weight: varint synapse index minus that of the previous changed weight, taken as -1 for the first,
+//   and varint of the weight bits XOR the bits of the previously recorded weight of the synapse.
+// The synapses are ordered by pre-synaptic neuron id and the previously recorded weights start out as 0, so the
+// first snapshot holds every nonzero weight. A default constructed recorder is disabled.
+class WeightRecorder {
+public:
+    WeightRecorder() noexcept;
+    WeightRecorder(const Population& population, SizeType sampleIntervalNumCycles, const std::string& filePath);
+
+    bool isEnabled() const noexcept {
+        return sampleIntervalNumCycles > 0;
+    }
+
+    void onCycleEnd(SizeType cycleId, TimeType time) {
+        if (cycleId == nextSampleCycleId && isEnabled()) {
+            recordSnapshot(time);
+            nextSampleCycleId += sampleIntervalNumCycles;
+        }
+    }
+
+    void finish();
+
+    SizeType getNumSnapshots() const noexcept;
+    SizeType getNumRecordedChanges() const noexcept;
+
+private:
+    void recordSnapshot(TimeType time);
+    void writeVarint(uint64_t value);
+    void flush();
+
+    std::vector<const Synapse*> synapses;
+    std::vector<ValueType> recordedWeights;
+    std::vector<SizeType> changedIndices;
+    SizeType sampleIntervalNumCycles;
+    SizeType nextSampleCycleId;
+    SizeType numSnapshots;
+    SizeType numRecordedChanges;
+    std::string buffer;
+    std::ofstream file;
+};
+
+}
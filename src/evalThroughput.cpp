@@ -0,0 +1,91 @@
+#include <plog/Formatters/TxtFormatter.h>
+#include <plog/Appenders/ConsoleAppender.h>
+#include <plog/Init.h>
+#include <plog/Log.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <util/BenchmarkComparison.hpp>
+#include <util/FileUtil.hpp>
+#include <util/NumaTopology.hpp>
+#include <evolution/Evolution.hpp>
+#include <experiments/POCDynamicSimulation.hpp>
+
+using namespace plog;
+using namespace soft_npu;
+
+double measureEvalsPerSecond(const ParamsType& templateParams, bool pinWorkerThreads) {
+    EvolutionParams evolutionParams;
+    evolutionParams.maxNumIterations = 2;
+    evolutionParams.populationSize = 2 * std::max(1u, std::thread::hardware_concurrency());
+    evolutionParams.eliteSize = 1;
+    evolutionParams.resultExtractionNumCandidates = 1;
+    evolutionParams.resultExtractionNumEvalSeeds = 1;
+    evolutionParams.pinWorkerThreads = pinWorkerThreads;
+
+    // the gene is not used, every evaluation simulates the template with its own seed
+    auto geneInfoJson = R"([{"id": "x", "prototypeValue": 0.0, "minValue": 0.0, "maxValue": 1.0}])"_json;
+
+    std::atomic<SizeType> numEvaluations(0);
+
+    auto fitnessFunction = [&templateParams, &numEvaluations](const ParamsType&, SizeType seed) {
+        auto params = std::make_shared<ParamsType>(templateParams);
+        (*params)["simulation"]["seed"] = static_cast<int>(seed);
+
+        POCDynamicSimulation simulation(params);
+        simulation.run();
+
+        ++ numEvaluations;
+        return simulation.optimResultHolder.objFuncVal;
+    };
+
+    auto startTs = std::chrono::steady_clock::now();
+    Evolution::run(evolutionParams, fitnessFunction, geneInfoJson);
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTs;
+
+    return numEvaluations.load() / duration.count();
+}
+
+// usage: evalThroughput [untilTime] [numRepetitions]
+int main(int argc, char * argv[])
+{
+    ConsoleAppender<plog::TxtFormatter> consoleAppender;
+
+    plog::init(plog::info, &consoleAppender);
+
+    PLOG_INFO << "Evaluation throughput benchmark starting";
+
+    auto templateParams = ParamsType::parse(FileUtil::getFileContent("../resources/paramsTemplate.json"));
+    templateParams["simulation"]["untilTime"] = argc > 1 ? std::stod(argv[1]) : 20.0;
+    int numRepetitions = argc > 2 ? std::stoi(argv[2]) : 5;
+    templateParams["pocDynamicSimulation"]["abortAfterWallSeconds"] = std::numeric_limits<double>::max();
+
+    for (const auto& numaNode : NumaTopology::readNumaNodes()) {
+        PLOG_INFO << "NUMA node " << numaNode.nodeId << ": " << numaNode.cpuIds.size() << " CPU(s)";
+    }
+
+    // alternates the modes, so that warm-up and drift do not favour either of them
+    std::vector<double> unpinnedSamples;
+    std::vector<double> pinnedSamples;
+
+    for (int repetition = 0; repetition < numRepetitions; ++repetition) {
+        bool isPinnedFirst = repetition % 2 == 1;
+        (isPinnedFirst ? pinnedSamples : unpinnedSamples).push_back(measureEvalsPerSecond(templateParams, isPinnedFirst));
+        (isPinnedFirst ? unpinnedSamples : pinnedSamples).push_back(measureEvalsPerSecond(templateParams, !isPinnedFirst));
+
+        PLOG_INFO << "Repetition " << repetition << ": " << unpinnedSamples.back() << " unpinned, "
+            << pinnedSamples.back() << " pinned evaluations per second";
+    }
+
+    auto unpinnedEvalsPerSecond = BenchmarkComparison::median(unpinnedSamples);
+    auto pinnedEvalsPerSecond = BenchmarkComparison::median(pinnedSamples);
+
+    PLOG_INFO << "Median evaluations per second, unpinned: " << unpinnedEvalsPerSecond
+        << " (MAD " << BenchmarkComparison::medianAbsoluteDeviation(unpinnedSamples) << ")";
+    PLOG_INFO << "Median evaluations per second, pinned: " << pinnedEvalsPerSecond
+        << " (MAD " << BenchmarkComparison::medianAbsoluteDeviation(pinnedSamples) << ", "
+        << pinnedEvalsPerSecond / unpinnedEvalsPerSecond << "x)";
+    PLOG_INFO << "Terminating";
+}
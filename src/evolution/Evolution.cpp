@@ -12,6 +12,8 @@
 #include "Gene.hpp"
 #include "MutationParams.hpp"
 #include <util/InterruptSignalChecker.hpp>
+#include <util/WorkerThreadPinner.hpp>
+#include <util/Tracer.hpp>
 
 namespace soft_npu {
 
@@ -38,6 +40,8 @@ void validateEvolutionParams(const EvolutionParams& params) {
         throw std::runtime_error("Result extraction num candidates must not be greater than population size");
     } else if (params.resultExtractionNumEvalSeeds < 1) {
         throw std::runtime_error("Result extraction num evaluation seeds must be strictly positive");
+    } else if (params.fitnessBatchSize < 1) {
+        throw std::runtime_error("Fitness batch size must be strictly positive");
     }
 }
 
@@ -111,31 +115,59 @@ struct CandidateEvalJob {
 };
 
 EvaluatedCandidates evaluateFitness(
+        const EvolutionParams& evolutionParams,
         const Candidates& candidates,
         const FitnessFunction& fitnessFunction,
         RandomEngineType& randomEngine) {
 
+    ScopedTraceSpan traceSpan("evaluate fitness", "evolution");
+
+    auto batchSize = evolutionParams.fitnessBatchSize;
     std::vector<CandidateEvalJob> jobs;
+    std::vector<SizeType> batchBeginIndices;
 
-    std::transform(
-            candidates.cbegin(),
-            candidates.cend(),
-            std::back_inserter(jobs),
-            [&randomEngine](auto candidate) {
-                CandidateEvalJob job;
-                job.candidate = candidate;
-                job.seed = randomEngine();
-                job.resultFitnessValue = std::numeric_limits<ValueType>::quiet_NaN();
-                return job;
-            });
+    // the first candidate of each batch draws the seed of the batch
+    for (const auto& candidate : candidates) {
+        CandidateEvalJob job;
+        job.candidate = candidate;
+
+        if (jobs.size() % batchSize == 0) {
+            batchBeginIndices.push_back(jobs.size());
+            job.seed = randomEngine();
+        } else {
+            job.seed = jobs.back().seed;
+        }
+
+        job.resultFitnessValue = std::numeric_limits<ValueType>::quiet_NaN();
+        jobs.push_back(job);
+    }
 
     std::for_each(
             std::execution::par,
-            jobs.begin(),
-            jobs.end(),
-            [&fitnessFunction](auto& job) {
-                job.resultFitnessValue = fitnessFunction.evaluate(
-                        *job.candidate->getGeneValue(), job.seed);
+            batchBeginIndices.cbegin(),
+            batchBeginIndices.cend(),
+            [&fitnessFunction, &jobs, batchSize](SizeType batchBeginIndex) {
+                auto batchEndIndex = std::min(batchBeginIndex + batchSize, jobs.size());
+                auto seed = jobs[batchBeginIndex].seed;
+                ScopedTraceSpan traceSpan("fitness evaluation", "evolution", static_cast<int64_t>(seed));
+
+                if (batchEndIndex - batchBeginIndex == 1) {
+                    jobs[batchBeginIndex].resultFitnessValue = fitnessFunction.evaluate(
+                            *jobs[batchBeginIndex].candidate->getGeneValue(), seed);
+                    return;
+                }
+
+                std::vector<const ParamsType*> geneValues;
+
+                for (auto i = batchBeginIndex; i < batchEndIndex; ++i) {
+                    geneValues.push_back(jobs[i].candidate->getGeneValue().get());
+                }
+
+                auto fitnessValues = fitnessFunction.evaluateBatch(geneValues, seed);
+
+                for (auto i = batchBeginIndex; i < batchEndIndex; ++i) {
+                    jobs[i].resultFitnessValue = fitnessValues[i - batchBeginIndex];
+                }
             });
 
     EvaluatedCandidates result;
@@ -173,6 +205,7 @@ void iterate(
     PLOG_DEBUG << "Evaluating main population fitness";
 
     EvaluatedCandidates evaluatedNewCandidates = evaluateFitness(
+            evolutionParams,
             newGenerationCandidates,
             fitnessFunction,
             randomEngine);
@@ -192,6 +225,8 @@ CandidateWithFitness extractBestCandidate(
         const FitnessFunction& fitnessFunction,
         RandomEngineType& randomEngine) {
 
+    ScopedTraceSpan traceSpan("extract best candidate", "evolution");
+
     std::vector<std::vector<ValueType>> fitnessValues(evolutionParams.resultExtractionNumCandidates);
 
     std::vector<ValueType> fillValue(evolutionParams.resultExtractionNumEvalSeeds);
@@ -220,6 +255,7 @@ CandidateWithFitness extractBestCandidate(
             jobs.cbegin(),
             jobs.cend(),
             [&sortedCandidates, &fitnessValues, &fitnessFunction](const auto& job) {
+                ScopedTraceSpan traceSpan("result extraction evaluation", "evolution", static_cast<int64_t>(job.seed));
                 auto fitnessValue = fitnessFunction.evaluate(
                         *sortedCandidates[job.candidateIndex].candidate->getGeneValue(),
                         job.seed);
@@ -261,6 +297,16 @@ EvolutionResult Evolution::runImpl(
 
     validateEvolutionParams(evolutionParams);
 
+    std::unique_ptr<WorkerThreadPinner> workerThreadPinner;
+
+    if (evolutionParams.pinWorkerThreads) {
+        auto numaNodes = NumaTopology::readNumaNodes();
+        PLOG_INFO << "Pinning worker threads across " << numaNodes.size() << " NUMA node(s)";
+        workerThreadPinner = std::make_unique<WorkerThreadPinner>(numaNodes);
+    }
+
+    TraceSession traceSession(evolutionParams.traceFilePath, evolutionParams.traceCycleSampleInterval);
+
     Candidates population;
 
     RandomEngineType randomEngine(0);
@@ -274,7 +320,7 @@ EvolutionResult Evolution::runImpl(
                 originCandidate->getGene()->mutate(generateMutationParams(randomEngine, evolutionParams), randomEngine)));
     }
 
-    auto evaluatedCandidates = evaluateFitness(population, fitnessFunction, randomEngine);
+    auto evaluatedCandidates = evaluateFitness(evolutionParams, population, fitnessFunction, randomEngine);
 
     TerminationReason terminationReason;
     int iteration = 0;
@@ -335,6 +381,16 @@ EvolutionResult Evolution::runImpl(
     result.numberOfIterations = iteration;
     result.topGeneValue = bestCandidate.candidate->getGeneValue();
 
+    if (traceSession.finish()) {
+        PLOG_INFO << "Trace written to " << evolutionParams.traceFilePath;
+    }
+
+    if (evolutionParams.pinWorkerThreads) {
+        for (const auto& [nodeId, residentBytes] : NumaTopology::getResidentBytesByNode()) {
+            PLOG_INFO << "Resident memory on NUMA node " << nodeId << ": " << residentBytes / (1 << 20) << " MiB";
+        }
+    }
+
     PLOG_INFO << "Evolution terminated, reason: " << toString(terminationReason)
         << ", achieved fitness value: " << result.topFitnessValue;
 
@@ -15,7 +15,11 @@ plog::Record& operator<<(plog::Record& record, const EvolutionParams& evolutionP
         << "Crossover probability: " << evolutionParams.crossoverProbability << std::endl
         << "Tournament selection probability: " << evolutionParams.tournamentSelectionProbability << std::endl
         << "Result extraction num evaluation seeds: " << evolutionParams.resultExtractionNumEvalSeeds << std::endl
-        << "Result extraction num candidates: " << evolutionParams.resultExtractionNumCandidates << std::endl;
+        << "Result extraction num candidates: " << evolutionParams.resultExtractionNumCandidates << std::endl
+        << "Pin worker threads: " << evolutionParams.pinWorkerThreads << std::endl
+        << "Fitness batch size: " << evolutionParams.fitnessBatchSize << std::endl
+        << "Trace file path: " << evolutionParams.traceFilePath << std::endl
+        << "Trace cycle sample interval: " << evolutionParams.traceCycleSampleInterval << std::endl;
 
     return record;
 }
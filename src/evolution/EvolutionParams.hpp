@@ -1,6 +1,7 @@
 #pragma once
 
 #include <limits>
+#include <string>
 #include <Aliases.hpp>
 #include <plog/Record.h>
 
@@ -22,6 +23,13 @@ struct EvolutionParams {
     ValueType tournamentSelectionProbability = 0.75;
     SizeType resultExtractionNumEvalSeeds = 10;
     SizeType resultExtractionNumCandidates = 10;
+    bool pinWorkerThreads = false;
+    // consecutive candidates evaluated together on one seed, see FitnessFunction::evaluateBatch; 1 gives every
+    // candidate its own seed
+    SizeType fitnessBatchSize = 1;
+    // Chrome trace event file of fitness evaluations and sampled simulation cycles, none if empty
+    std::string traceFilePath;
+    SizeType traceCycleSampleInterval = 1000;
 };
 
 plog::Record& operator<<(plog::Record&, const EvolutionParams&);
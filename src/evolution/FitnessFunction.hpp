@@ -1,11 +1,25 @@
 #pragma once
 
 #include <Aliases.hpp>
+#include <vector>
 
 namespace soft_npu {
 
 struct FitnessFunction {
     virtual double evaluate(const ParamsType&, SizeType randomSeed) const = 0;
+
+    // The instances of a batch share one seed, so that simulations draw the same population structure and inputs for
+    // all of them. One fitness value per gene value, in order.
+    virtual std::vector<double> evaluateBatch(const std::vector<const ParamsType*>& geneValues, SizeType randomSeed) const {
+        std::vector<double> fitnessValues;
+
+        for (auto geneValue : geneValues) {
+            fitnessValues.push_back(evaluate(*geneValue, randomSeed));
+        }
+
+        return fitnessValues;
+    }
+
     virtual ~FitnessFunction() = default;
 };
 
@@ -4,6 +4,8 @@ namespace soft_npu {
 
 struct OptimResultHolder {
     double objFuncVal;
+    double partCorrect;
+    double partWrong;
 };
 
 }
\ No newline at end of file
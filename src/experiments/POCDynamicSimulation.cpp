@@ -11,16 +11,32 @@
 #include "EnvEvent.hpp"
 #include <core/SynapticTransmissionStats.hpp>
 #include <chrono>
+#include <limits>
+#include <stdexcept>
 
 namespace soft_npu {
 
+static ValueType getAbortAboveFiringRate(const ParamsType& params) {
+    auto it = params["pocDynamicSimulation"].find("abortAboveFiringRate");
+    if (it == params["pocDynamicSimulation"].end()) {
+        return std::numeric_limits<ValueType>::infinity();
+    }
+
+    if (params.find("firingRateMonitor") == params.end()) {
+        throw std::runtime_error("pocDynamicSimulation.abortAboveFiringRate requires a firingRateMonitor section");
+    }
+
+    return it->get<ValueType>();
+}
+
 POCDynamicSimulation::POCDynamicSimulation(std::shared_ptr<const ParamsType> params) :
     AbstractSimulation(params),
     optimResultHolder(),
     rewardDosage((*params)["pocDynamicSimulation"]["rewardDosage"]),
     abortAfterWallSeconds((*params)["pocDynamicSimulation"]["abortAfterWallSeconds"]),
     costAfterWallSeconds((*params)["pocDynamicSimulation"]["costAfterWallSeconds"]),
-    flipDetectorChannels((*params)["pocDynamicSimulation"]["flipDetectorChannels"]) {
+    flipDetectorChannels((*params)["pocDynamicSimulation"]["flipDetectorChannels"]),
+    abortAboveFiringRate(getAbortAboveFiringRate(*params)) {
 }
 
 bool timeCrossed(TimeType threshold, TimeType currentTime, TimeType dt) {
@@ -155,6 +171,14 @@ void POCDynamicSimulation::runController(
             return;
         }
 
+        // runaway activity
+        if (controller.getFiringRateMonitor().getMaxFiringRate() > abortAboveFiringRate) {
+            PLOG_DEBUG << "Aborting at " << currentTime << " s, firing rate "
+                << controller.getFiringRateMonitor().getMaxFiringRate() << " Hz";
+            optimResultHolder.objFuncVal = std::numeric_limits<double>::max();
+            return;
+        }
+
         for (
             auto it = cycleOutputBuffer.cbeginSpikingChannelIds();
             it != cycleOutputBuffer.cendSpikingChannelIds();
@@ -186,6 +210,8 @@ void POCDynamicSimulation::runController(
     double objCandidate = 1 - partCorrect + partWrong + timePart;
 
     optimResultHolder.objFuncVal = objCandidate;
+    optimResultHolder.partCorrect = partCorrect;
+    optimResultHolder.partWrong = partWrong;
 }
 
 }
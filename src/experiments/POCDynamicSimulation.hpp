@@ -17,9 +17,11 @@ public:
 
     OptimResultHolder optimResultHolder;
     ValueType rewardDosage;
-    ValueType abortAfterWallSeconds;
-    ValueType costAfterWallSeconds;
+    TimeType abortAfterWallSeconds;
+    TimeType costAfterWallSeconds;
     bool flipDetectorChannels;
+    // requires the firing rate monitor, no limit otherwise
+    ValueType abortAboveFiringRate;
 };
 
 }
@@ -66,6 +66,14 @@ std::unordered_set<SizeType> CloningPopulationGenerator::ThrowingChannelProjecto
     throw std::runtime_error(msg);
 }
 
+std::unordered_set<SizeType> CloningPopulationGenerator::ThrowingChannelProjector::getSensoryNeuronIds() const {
+    throw std::runtime_error(msg);
+}
+
+void CloningPopulationGenerator::ThrowingChannelProjector::rebindTargetNeurons(const Population&) {
+    throw std::runtime_error(msg);
+}
+
 ChannelProjector::ChannelSpikeProjectionResult
 CloningPopulationGenerator::ThrowingChannelProjector::getEPSPsWithTargetNeurons(SizeType) const {
     throw std::runtime_error(msg);
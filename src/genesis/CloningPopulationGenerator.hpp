@@ -16,6 +16,8 @@ private:
 
         void projectNeuronSpike(CycleOutputBuffer& cycleOutputBuffer, const Neuron& spikingNeuron) const override;
         std::unordered_set<SizeType> getMotorNeuronIds() const override;
+        std::unordered_set<SizeType> getSensoryNeuronIds() const override;
+        void rebindTargetNeurons(const Population& population) override;
 
     protected:
         ChannelSpikeProjectionResult getEPSPsWithTargetNeurons(SizeType channelId) const override;
@@ -0,0 +1,168 @@
+#include "NeuronOrdering.hpp"
+#include <neuro/Population.hpp>
+#include <algorithm>
+#include <numeric>
+
+namespace soft_npu::NeuronOrdering {
+
+std::vector<std::vector<SizeType>> getUndirectedAdjacency(const Population& population) {
+
+    std::vector<std::vector<SizeType>> adjacency(population.getPopulationSize());
+
+    auto connect = [&adjacency](SizeType neuronId0, SizeType neuronId1) {
+        adjacency[neuronId0].push_back(neuronId1);
+        adjacency[neuronId1].push_back(neuronId0);
+    };
+
+    for (auto it = population.cbeginNeurons(); it != population.cendNeurons(); ++it) {
+        const auto& neuron = **it;
+
+        for (auto synIt = neuron.cbeginOutboundSynapses(); synIt != neuron.cendOutboundSynapses(); ++synIt) {
+            connect(neuron.getNeuronId(), (*synIt)->postSynapticNeuron->getNeuronId());
+        }
+
+        for (auto sourceIt = neuron.cbeginInhibitionSources(); sourceIt != neuron.cendInhibitionSources(); ++sourceIt) {
+            connect(neuron.getNeuronId(), (*sourceIt)->getNeuronId());
+        }
+    }
+
+    for (auto& neighbors : adjacency) {
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    }
+
+    return adjacency;
+}
+
+std::vector<SizeType> reverseCuthillMcKee(const Population& population) {
+
+    auto adjacency = getUndirectedAdjacency(population);
+    auto numNeurons = adjacency.size();
+
+    auto hasLowerDegree = [&adjacency](SizeType neuronId0, SizeType neuronId1) {
+        return adjacency[neuronId0].size() < adjacency[neuronId1].size();
+    };
+
+    std::vector<SizeType> neuronIdsByDegree(numNeurons);
+    std::iota(neuronIdsByDegree.begin(), neuronIdsByDegree.end(), 0);
+    std::stable_sort(neuronIdsByDegree.begin(), neuronIdsByDegree.end(), hasLowerDegree);
+
+    std::vector<bool> visited(numNeurons, false);
+    std::vector<SizeType> ordering;
+    ordering.reserve(numNeurons);
+    std::vector<SizeType> unvisitedNeighbors;
+
+    // each connected component is traversed breadth-first, starting from its lowest-degree neuron
+    for (auto startNeuronId : neuronIdsByDegree) {
+
+        if (visited[startNeuronId]) {
+            continue;
+        }
+
+        visited[startNeuronId] = true;
+        ordering.push_back(startNeuronId);
+
+        for (SizeType head = ordering.size() - 1; head < ordering.size(); ++head) {
+
+            unvisitedNeighbors.clear();
+
+            for (auto neighborId : adjacency[ordering[head]]) {
+                if (!visited[neighborId]) {
+                    visited[neighborId] = true;
+                    unvisitedNeighbors.push_back(neighborId);
+                }
+            }
+
+            std::stable_sort(unvisitedNeighbors.begin(), unvisitedNeighbors.end(), hasLowerDegree);
+            ordering.insert(ordering.end(), unvisitedNeighbors.cbegin(), unvisitedNeighbors.cend());
+        }
+    }
+
+    std::reverse(ordering.begin(), ordering.end());
+
+    return ordering;
+}
+
+SizeType getHilbertIndex(SizeType gridSize, SizeType x, SizeType y) {
+    SizeType index = 0;
+
+    for (SizeType s = gridSize / 2; s > 0; s /= 2) {
+        SizeType rx = (x & s) > 0;
+        SizeType ry = (y & s) > 0;
+        index += s * s * ((3 * rx) ^ ry);
+
+        if (ry == 0) {
+            if (rx == 1) {
+                x = s - 1 - x;
+                y = s - 1 - y;
+            }
+
+            std::swap(x, y);
+        }
+    }
+
+    return index;
+}
+
+std::vector<SizeType> hilbertCurve(const Population& population) {
+
+    constexpr SizeType gridSize = 1 << 16;
+
+    auto toGridCoordinate = [](ValueType coordinate) {
+        auto gridCoordinate = static_cast<SizeType>(std::max(static_cast<ValueType>(0), coordinate) * gridSize);
+        return std::min(gridSize - 1, gridCoordinate);
+    };
+
+    std::vector<SizeType> hilbertIndicesByNeuronId;
+
+    for (SizeType neuronId = 0; neuronId < population.getPopulationSize(); ++neuronId) {
+        auto location = population.getCellLocation(neuronId);
+        hilbertIndicesByNeuronId.push_back(
+                getHilbertIndex(gridSize, toGridCoordinate(location[0]), toGridCoordinate(location[1])));
+    }
+
+    std::vector<SizeType> ordering(population.getPopulationSize());
+    std::iota(ordering.begin(), ordering.end(), 0);
+    std::stable_sort(ordering.begin(), ordering.end(), [&hilbertIndicesByNeuronId](SizeType neuronId0, SizeType neuronId1) {
+        return hilbertIndicesByNeuronId[neuronId0] < hilbertIndicesByNeuronId[neuronId1];
+    });
+
+    return ordering;
+}
+
+OrderingFunction getOrderingFunction(const std::string& orderingName) {
+    if (orderingName == "rcm") {
+        return reverseCuthillMcKee;
+    } else if (orderingName == "hilbert") {
+        return hilbertCurve;
+    } else {
+        throw std::runtime_error("Invalid neuron ordering name: " + orderingName);
+    }
+}
+
+ValueType getMeanSynapticSpan(const Population& population, const std::vector<SizeType>& storageOrder) {
+
+    std::vector<SizeType> storagePositionsByNeuronId(storageOrder.size());
+
+    for (SizeType position = 0; position < storageOrder.size(); ++position) {
+        storagePositionsByNeuronId[storageOrder[position]] = position;
+    }
+
+    SizeType totalSpan = 0;
+    SizeType numSynapses = 0;
+
+    for (auto it = population.cbeginNeurons(); it != population.cendNeurons(); ++it) {
+        const auto& neuron = **it;
+        auto prePosition = storagePositionsByNeuronId[neuron.getNeuronId()];
+
+        for (auto synIt = neuron.cbeginOutboundSynapses(); synIt != neuron.cendOutboundSynapses(); ++synIt) {
+            auto postPosition = storagePositionsByNeuronId[(*synIt)->postSynapticNeuron->getNeuronId()];
+            totalSpan += prePosition > postPosition ? prePosition - postPosition : postPosition - prePosition;
+            ++ numSynapses;
+        }
+    }
+
+    return numSynapses == 0 ? 0 : static_cast<ValueType>(totalSpan) / numSynapses;
+}
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <vector>
+#include <string>
+
+namespace soft_npu {
+
+class Population;
+
+namespace NeuronOrdering {
+
+// An ordering maps a population to the sequence of its neuron ids in the order the neurons should be laid out
+// in memory. Neuron ids themselves are never changed by an ordering.
+using OrderingFunction = std::vector<SizeType> (*)(const Population&);
+
+std::vector<SizeType> reverseCuthillMcKee(const Population& population);
+std::vector<SizeType> hilbertCurve(const Population& population);
+
+OrderingFunction getOrderingFunction(const std::string& orderingName);
+
+// mean distance in storage positions between the pre- and post-synaptic neuron of a synapse
+ValueType getMeanSynapticSpan(const Population& population, const std::vector<SizeType>& storageOrder);
+
+}
+}
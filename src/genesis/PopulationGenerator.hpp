@@ -1,6 +1,8 @@
 #pragma once
 
 #include <neuro/Population.hpp>
+#include <core/PopulationPartition.hpp>
+#include <stdexcept>
 
 namespace soft_npu {
 
@@ -8,6 +10,12 @@ struct PopulationGenerator {
 public:
     virtual ~PopulationGenerator() {};
     virtual std::unique_ptr<Population> generatePopulation() = 0;
+
+    // only the part of the population simulated by one process of a partitioned simulation, with the same neurons,
+    // synapses and channel projection as generatePopulation
+    virtual std::unique_ptr<PopulationPartition> generatePartition(SizeType, SizeType) {
+        throw std::runtime_error("Population generator cannot generate partitions");
+    }
 };
 
 }
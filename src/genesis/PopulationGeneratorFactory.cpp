@@ -3,10 +3,11 @@
 #include "PopulationGeneratorDetailedParams.hpp"
 #include "PopulationGeneratorR2DSheet.hpp"
 #include "PopulationGeneratorEvo.hpp"
+#include "ReorderingPopulationGenerator.hpp"
 
 namespace soft_npu::PopulationGeneratorFactory {
 
-std::unique_ptr<PopulationGenerator> createFromParams(
+std::unique_ptr<PopulationGenerator> createGenerator(
         const ParamsType& params,
         RandomEngineType& randomEngine) {
     std::string populationGeneratorName = params["simulation"]["populationGenerator"];
@@ -26,4 +27,21 @@ std::unique_ptr<PopulationGenerator> createFromParams(
     }
 }
 
+std::unique_ptr<PopulationGenerator> createFromParams(
+        const ParamsType& params,
+        RandomEngineType& randomEngine) {
+
+    auto generator = createGenerator(params, randomEngine);
+
+    const auto& simulationParams = params["simulation"];
+    auto it = simulationParams.find("neuronOrdering");
+    if (it != simulationParams.end()) {
+        return std::make_unique<ReorderingPopulationGenerator>(
+                std::move(generator),
+                NeuronOrdering::getOrderingFunction(*it));
+    }
+
+    return generator;
+}
+
 }
@@ -4,7 +4,10 @@
 #include "NeuroComponentsFactory.hpp"
 #include "TrivialNeuroComponentsFactory.hpp"
 #include <neuro/ChannelProjectorFactory.hpp>
+#include <util/CounterBasedRandomEngine.hpp>
 #include <algorithm>
+#include <execution>
+#include <numeric>
 
 namespace soft_npu {
 
@@ -16,14 +19,73 @@ PopulationGeneratorP1000::PopulationGeneratorP1000(
     randomEngine(randomEngine) {
 }
 
-std::unique_ptr<Population> soft_npu::PopulationGeneratorP1000::generatePopulation() {
+namespace {
+
+constexpr SizeType numNeurons = 1000;
+constexpr SizeType firstInhibitoryNeuronId = 800;
+constexpr double connectionProbability = 0.1; // TODO: move to config 
+constexpr TimeType maxConductionDelay = 20e-3; // move to config 
+
+struct SynapseSpec {
+    SizeType postSynapticNeuronId;
+    TimeType conductionDelay;
+
+    // among all outbound synapses of the pre-synaptic neuron
+    SizeType synapseIndex;
+};
 
-    constexpr SizeType numNeurons = 1000;
-    constexpr double connectionProbability = 0.1; // TODO: move to config 
-    constexpr TimeType maxConductionDelay = 20e-3; // move to config 
+bool isInhibitoryNeuronId(SizeType neuronId) {
+    return neuronId >= firstInhibitoryNeuronId;
+}
+
+// the synapses of all pre-synaptic neurons onto the post-synaptic neurons accepted by isTarget; all random numbers are
+// drawn regardless, so that the synapses do not depend on the accepted neurons
+template<typename ExecutionPolicy, typename F>
+std::vector<std::vector<SynapseSpec>> drawSynapseSpecs(ExecutionPolicy&& policy, const ParamsType& params, F isTarget) {
     const auto p1000Params = params["populationGenerators"]["p1000"];
     const TimeType inhibitoryConductionDelayDeterministicPart = p1000Params["inhibitoryConductionDelayDeterministicPart"];
     const TimeType inhibitoryConductionDelayRandomPart = p1000Params["inhibitoryConductionDelayRandomPart"];
+
+    const uint64_t seed = params["simulation"]["seed"];
+    std::vector<std::vector<SynapseSpec>> synapseSpecsByPreSynapticNeuronId(numNeurons);
+    std::vector<SizeType> preSynapticNeuronIds(numNeurons);
+    std::iota(preSynapticNeuronIds.begin(), preSynapticNeuronIds.end(), 0);
+
+    // each pre-synaptic neuron draws from its own stream, so the result does not depend on scheduling
+    std::for_each(policy, preSynapticNeuronIds.cbegin(), preSynapticNeuronIds.cend(), [&](SizeType preSynapticNeuronId) {
+        CounterBasedRandomEngine neuronRandomEngine(
+                seed,
+                CounterBasedRandomEngine::Subsystem::populationGeneration,
+                static_cast<uint32_t>(preSynapticNeuronId),
+                0);
+        std::uniform_real_distribution<double> uniformDistribution;
+        bool isInhibitory = isInhibitoryNeuronId(preSynapticNeuronId);
+        auto& synapseSpecs = synapseSpecsByPreSynapticNeuronId[preSynapticNeuronId];
+        SizeType synapseIndex = 0;
+
+        for (SizeType postSynapticNeuronId = 0; postSynapticNeuronId < numNeurons; ++postSynapticNeuronId) {
+            if (preSynapticNeuronId != postSynapticNeuronId && uniformDistribution(neuronRandomEngine) < connectionProbability) {
+                TimeType conductionDelay = isInhibitory ?
+                                           inhibitoryConductionDelayDeterministicPart + uniformDistribution(neuronRandomEngine) * inhibitoryConductionDelayRandomPart :
+                                           std::max(1e-3, uniformDistribution(neuronRandomEngine) * maxConductionDelay);
+
+                if (isTarget(postSynapticNeuronId)) {
+                    synapseSpecs.push_back({postSynapticNeuronId, conductionDelay, synapseIndex});
+                }
+
+                ++ synapseIndex;
+            }
+        }
+    });
+
+    return synapseSpecsByPreSynapticNeuronId;
+}
+
+}
+
+std::unique_ptr<Population> soft_npu::PopulationGeneratorP1000::generatePopulation() {
+
+    const auto p1000Params = params["populationGenerators"]["p1000"];
     const ValueType inhibitorySynapseWeight = p1000Params["inhibitorySynapseWeight"];
     const ValueType excitatorySynapseInitialWeight = p1000Params["excitatorySynapseInitialWeight"];
 
@@ -38,44 +100,39 @@ std::unique_ptr<Population> soft_npu::PopulationGeneratorP1000::generatePopulati
     auto population = std::make_unique<Population>();
 
     for (SizeType neuronId = 0; neuronId < numNeurons; ++neuronId) {
-        bool isInhibitory = neuronId >= 800;
+        bool isInhibitory = isInhibitoryNeuronId(neuronId);
 
         auto neuron = factory.makeNeuron(neuronId, isInhibitory ? inhibitoryNeuronParams : excitatoryNeuronParams);
         neuronsById[neuronId] = neuron.get();
         population->addNeuron(std::move(neuron), Population::defaultLocation);
     }
 
-    std::uniform_real_distribution<double> uniformDistribution;
+    auto synapseSpecsByPreSynapticNeuronId = drawSynapseSpecs(std::execution::par, params, [](SizeType) {
+        return true;
+    });
 
     for (SizeType preSynapticNeuronId = 0; preSynapticNeuronId < numNeurons; ++ preSynapticNeuronId) {
 
-        for (SizeType postSynapticNeuronId = 0; postSynapticNeuronId < numNeurons; ++postSynapticNeuronId) {
-            if (preSynapticNeuronId != postSynapticNeuronId && uniformDistribution(randomEngine) < connectionProbability) {
+        for (const auto& synapseSpec : synapseSpecsByPreSynapticNeuronId[preSynapticNeuronId]) {
+            auto preSynapticNeuron = neuronsById[preSynapticNeuronId];
+            auto postSynapticNeuron = neuronsById[synapseSpec.postSynapticNeuronId];
 
-                auto preSynapticNeuron = neuronsById[preSynapticNeuronId];
-                auto postSynapticNeuron = neuronsById[postSynapticNeuronId];
+            bool isInhibitory = preSynapticNeuron->getNeuronParams()->isInhibitory;
+            ValueType initialWeight = isInhibitory ? inhibitorySynapseWeight : excitatorySynapseInitialWeight;
 
-                bool isInhibitory = preSynapticNeuron->getNeuronParams()->isInhibitory;
-                ValueType initialWeight = isInhibitory ? inhibitorySynapseWeight : excitatorySynapseInitialWeight;
+            auto synapse = factory.makeSynapse(
+                    synapseParams,
+                    preSynapticNeuron,
+                    postSynapticNeuron,
+                    synapseSpec.conductionDelay,
+                    initialWeight);
 
-                TimeType conductionDelay = isInhibitory ?
-                                           inhibitoryConductionDelayDeterministicPart + uniformDistribution(randomEngine) * inhibitoryConductionDelayRandomPart :
-                                           std::max(1e-3, uniformDistribution(randomEngine) * maxConductionDelay);
-
-                auto synapse = factory.makeSynapse(
-                        synapseParams,
-                        preSynapticNeuron,
-                        postSynapticNeuron,
-                        conductionDelay,
-                        initialWeight);
-
-                preSynapticNeuron->addOutboundSynapse(synapse.get());
-
-                if (isInhibitory) {
-                    population->addInhibitorySynapse(std::move(synapse));
-                } else {
-                    population->addExcitatorySynapse(std::move(synapse));
-                }
+            preSynapticNeuron->addOutboundSynapse(synapse.get());
+
+            if (isInhibitory) {
+                population->addInhibitorySynapse(std::move(synapse));
+            } else {
+                population->addExcitatorySynapse(std::move(synapse));
             }
         }
     }
@@ -85,5 +142,64 @@ std::unique_ptr<Population> soft_npu::PopulationGeneratorP1000::generatePopulati
     return population;
 }
 
+std::unique_ptr<PopulationPartition> PopulationGeneratorP1000::generatePartition(SizeType numPartitions, SizeType partitionId) {
+
+    const auto p1000Params = params["populationGenerators"]["p1000"];
+    const ValueType inhibitorySynapseWeight = p1000Params["inhibitorySynapseWeight"];
+    const ValueType excitatorySynapseInitialWeight = p1000Params["excitatorySynapseInitialWeight"];
+
+    auto excitatoryNeuronParams = ParamsFactories::extractExcitatoryNeuronParams(params);
+    auto inhibitoryNeuronParams = ParamsFactories::extractInhibitoryNeuronParams(params);
+    auto synapseParams = ParamsFactories::extractSynapseParams(params);
+
+    TrivialNeuroComponentsFactory factory;
+
+    auto partition = std::make_unique<PopulationPartition>(numNeurons, numPartitions, partitionId);
+    auto& population = partition->getPopulation();
+
+    for (SizeType neuronId = 0; neuronId < numNeurons; ++neuronId) {
+        if (partition->isLocal(neuronId)) {
+            bool isInhibitory = isInhibitoryNeuronId(neuronId);
+            population.addNeuron(
+                    factory.makeNeuron(neuronId, isInhibitory ? inhibitoryNeuronParams : excitatoryNeuronParams),
+                    Population::defaultLocation);
+        } else {
+            population.addRemoteNeuron(Population::defaultLocation);
+        }
+    }
+
+    // partitions are generated in forked processes, where the parallel algorithms' thread pool must not be used
+    auto synapseSpecsByPreSynapticNeuronId = drawSynapseSpecs(std::execution::seq, params, [&partition](SizeType postSynapticNeuronId) {
+        return partition->isLocal(postSynapticNeuronId);
+    });
+
+    for (SizeType preSynapticNeuronId = 0; preSynapticNeuronId < numNeurons; ++ preSynapticNeuronId) {
+        bool isInhibitory = isInhibitoryNeuronId(preSynapticNeuronId);
+        ValueType initialWeight = isInhibitory ? inhibitorySynapseWeight : excitatorySynapseInitialWeight;
+        auto preSynapticNeuron = partition->isLocal(preSynapticNeuronId) ? &population.getNeuronById(preSynapticNeuronId) : nullptr;
+
+        for (const auto& synapseSpec : synapseSpecsByPreSynapticNeuronId[preSynapticNeuronId]) {
+            auto synapse = factory.makeSynapse(
+                    synapseParams,
+                    preSynapticNeuron,
+                    &population.getNeuronById(synapseSpec.postSynapticNeuronId),
+                    synapseSpec.conductionDelay,
+                    initialWeight);
+
+            partition->addSynapse(preSynapticNeuronId, isInhibitory, synapseSpec.synapseIndex, synapse.get());
+
+            if (isInhibitory) {
+                population.addInhibitorySynapse(std::move(synapse));
+            } else {
+                population.addExcitatorySynapse(std::move(synapse));
+            }
+        }
+    }
+
+    population.setChannelProjector(ChannelProjectorFactory::createFromParams(params, randomEngine, population));
+
+    return partition;
+}
+
 
 }
@@ -12,6 +12,7 @@ public:
             RandomEngineType& randomEngine);
 
     std::unique_ptr<Population> generatePopulation() override;
+    std::unique_ptr<PopulationPartition> generatePartition(SizeType numPartitions, SizeType partitionId) override;
 
 private:
     const ParamsType& params;
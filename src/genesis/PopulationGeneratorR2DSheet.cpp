@@ -3,6 +3,7 @@
 #include "TrivialNeuroComponentsFactory.hpp"
 #include "SynapseInjectionR2DSheet.hpp"
 #include <neuro/ChannelProjectorFactory.hpp>
+#include <util/CounterBasedRandomEngine.hpp>
 
 namespace soft_npu {
 
@@ -12,39 +13,160 @@ PopulationGeneratorR2DSheet::PopulationGeneratorR2DSheet(const ParamsType& param
 
 }
 
-std::unique_ptr<Population> PopulationGeneratorR2DSheet::generatePopulation() {
+namespace {
+
+struct SheetNeurons {
+    std::vector<Population::Location> locationsByNeuronId;
+    std::vector<bool> isInhibitoryByNeuronId;
+};
 
+// each neuron draws its location from its own stream, so that every partition can draw the locations of all neurons
+SheetNeurons drawSheetNeurons(const ParamsType& params) {
     auto generatorParams = params["populationGenerators"]["r2dSheet"];
     SizeType numNeurons = generatorParams["numNeurons"];
     ValueType pctInhibitoryNeurons = generatorParams["pctInhibitoryNeurons"];
 
+    const uint64_t seed = params["simulation"]["seed"];
+    std::uniform_real_distribution<ValueType> uniformDistribution;
+
+    SheetNeurons sheetNeurons;
+
+    for (SizeType neuronId = 0; neuronId < numNeurons; ++ neuronId) {
+        CounterBasedRandomEngine neuronRandomEngine(
+                seed,
+                CounterBasedRandomEngine::Subsystem::populationGeneration,
+                static_cast<uint32_t>(neuronId),
+                0);
+
+        Population::Location location = {
+                uniformDistribution(neuronRandomEngine),
+                uniformDistribution(neuronRandomEngine)
+        };
+
+        sheetNeurons.locationsByNeuronId.push_back(location);
+        sheetNeurons.isInhibitoryByNeuronId.push_back(neuronId >= (1 - pctInhibitoryNeurons) * numNeurons);
+    }
+
+    return sheetNeurons;
+}
+
+}
+
+std::unique_ptr<Population> PopulationGeneratorR2DSheet::generatePopulation() {
+
     auto excitatoryNeuronParams = ParamsFactories::extractExcitatoryNeuronParams(params);
     auto inhibitoryNeuronParams = ParamsFactories::extractInhibitoryNeuronParams(params);
+    auto synapseParams = ParamsFactories::extractSynapseParams(params);
 
     TrivialNeuroComponentsFactory factory;
 
-    std::uniform_real_distribution<ValueType> uniformDistribution;
-
     auto population = std::make_unique<Population>();
+    auto sheetNeurons = drawSheetNeurons(params);
+    SizeType numNeurons = sheetNeurons.locationsByNeuronId.size();
 
     for (SizeType neuronId = 0; neuronId < numNeurons; ++ neuronId) {
-        bool isInhibitory = neuronId >= (1 - pctInhibitoryNeurons) * numNeurons;
-
-        Population::Location location = {
-                uniformDistribution(randomEngine),
-                uniformDistribution(randomEngine)
-        };
+        bool isInhibitory = sheetNeurons.isInhibitoryByNeuronId[neuronId];
 
         auto neuron = factory.makeNeuron(neuronId, isInhibitory ? inhibitoryNeuronParams : excitatoryNeuronParams);
 
-        population->addNeuron(std::move(neuron), location);
+        population->addNeuron(std::move(neuron), sheetNeurons.locationsByNeuronId[neuronId]);
     }
 
-    SynapseInjectionR2DSheet::injectSynapses(params, randomEngine, factory, *population);
+    auto synapseSpecsByPreSynapticNeuronId = SynapseInjectionR2DSheet::drawSynapseSpecs(
+            params,
+            sheetNeurons.locationsByNeuronId,
+            sheetNeurons.isInhibitoryByNeuronId,
+            [](SizeType) {
+        return true;
+    });
+
+    for (SizeType preSynapticNeuronId = 0; preSynapticNeuronId < numNeurons; ++ preSynapticNeuronId) {
+        auto& preSynapticNeuron = population->getNeuronById(preSynapticNeuronId);
+
+        for (const auto& synapseSpec : synapseSpecsByPreSynapticNeuronId[preSynapticNeuronId]) {
+            auto synapse = factory.makeSynapse(
+                    synapseParams,
+                    &preSynapticNeuron,
+                    &population->getNeuronById(synapseSpec.postSynapticNeuronId),
+                    synapseSpec.conductionDelay,
+                    synapseSpec.initialWeight);
+
+            preSynapticNeuron.addOutboundSynapse(synapse.get());
+
+            if (sheetNeurons.isInhibitoryByNeuronId[preSynapticNeuronId]) {
+                population->addInhibitorySynapse(std::move(synapse));
+            } else {
+                population->addExcitatorySynapse(std::move(synapse));
+            }
+        }
+    }
 
     population->setChannelProjector(ChannelProjectorFactory::createFromParams(params, randomEngine, *population));
 
     return population;
 }
 
+std::unique_ptr<PopulationPartition> PopulationGeneratorR2DSheet::generatePartition(
+        SizeType numPartitions, SizeType partitionId) {
+
+    auto excitatoryNeuronParams = ParamsFactories::extractExcitatoryNeuronParams(params);
+    auto inhibitoryNeuronParams = ParamsFactories::extractInhibitoryNeuronParams(params);
+    auto synapseParams = ParamsFactories::extractSynapseParams(params);
+
+    TrivialNeuroComponentsFactory factory;
+
+    auto sheetNeurons = drawSheetNeurons(params);
+    SizeType numNeurons = sheetNeurons.locationsByNeuronId.size();
+
+    auto partition = std::make_unique<PopulationPartition>(numNeurons, numPartitions, partitionId);
+    auto& population = partition->getPopulation();
+
+    for (SizeType neuronId = 0; neuronId < numNeurons; ++ neuronId) {
+        const auto& location = sheetNeurons.locationsByNeuronId[neuronId];
+
+        if (partition->isLocal(neuronId)) {
+            bool isInhibitory = sheetNeurons.isInhibitoryByNeuronId[neuronId];
+            population.addNeuron(
+                    factory.makeNeuron(neuronId, isInhibitory ? inhibitoryNeuronParams : excitatoryNeuronParams),
+                    location);
+        } else {
+            population.addRemoteNeuron(location);
+        }
+    }
+
+    auto synapseSpecsByPreSynapticNeuronId = SynapseInjectionR2DSheet::drawSynapseSpecs(
+            params,
+            sheetNeurons.locationsByNeuronId,
+            sheetNeurons.isInhibitoryByNeuronId,
+            [&partition](SizeType postSynapticNeuronId) {
+        return partition->isLocal(postSynapticNeuronId);
+    });
+
+    for (SizeType preSynapticNeuronId = 0; preSynapticNeuronId < numNeurons; ++ preSynapticNeuronId) {
+        bool isInhibitory = sheetNeurons.isInhibitoryByNeuronId[preSynapticNeuronId];
+        auto preSynapticNeuron = partition->isLocal(preSynapticNeuronId) ? &population.getNeuronById(preSynapticNeuronId) : nullptr;
+
+        for (const auto& synapseSpec : synapseSpecsByPreSynapticNeuronId[preSynapticNeuronId]) {
+            auto synapse = factory.makeSynapse(
+                    synapseParams,
+                    preSynapticNeuron,
+                    &population.getNeuronById(synapseSpec.postSynapticNeuronId),
+                    synapseSpec.conductionDelay,
+                    synapseSpec.initialWeight);
+
+            partition->addSynapse(preSynapticNeuronId, isInhibitory, synapseSpec.synapseIndex, synapse.get());
+
+            if (isInhibitory) {
+                population.addInhibitorySynapse(std::move(synapse));
+            } else {
+                population.addExcitatorySynapse(std::move(synapse));
+            }
+        }
+    }
+
+    population.setChannelProjector(ChannelProjectorFactory::createFromParams(params, randomEngine, population));
+
+    return partition;
+}
+
 }
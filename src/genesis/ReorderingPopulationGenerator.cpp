@@ -0,0 +1,76 @@
+#include "ReorderingPopulationGenerator.hpp"
+#include "TrivialNeuroComponentsFactory.hpp"
+#include <plog/Log.h>
+#include <numeric>
+
+namespace soft_npu {
+
+ReorderingPopulationGenerator::ReorderingPopulationGenerator(
+        std::unique_ptr<PopulationGenerator> generator,
+        NeuronOrdering::OrderingFunction orderingFunction) :
+    generator(std::move(generator)),
+    orderingFunction(orderingFunction) {
+}
+
+std::unique_ptr<Population> ReorderingPopulationGenerator::generatePopulation() {
+
+    auto source = generator->generatePopulation();
+    auto storageOrder = orderingFunction(*source);
+
+    std::vector<SizeType> generatorOrder(source->getPopulationSize());
+    std::iota(generatorOrder.begin(), generatorOrder.end(), 0);
+
+    PLOG_DEBUG << "Reordering neurons, mean synaptic span before: "
+        << NeuronOrdering::getMeanSynapticSpan(*source, generatorOrder)
+        << ", after: " << NeuronOrdering::getMeanSynapticSpan(*source, storageOrder);
+
+    TrivialNeuroComponentsFactory factory;
+
+    std::vector<std::unique_ptr<Neuron>> relocatedNeuronsById(source->getPopulationSize());
+
+    for (auto neuronId : storageOrder) {
+        relocatedNeuronsById[neuronId] = factory.makeNeuron(neuronId, source->getNeuronById(neuronId).getNeuronParams());
+    }
+
+    auto population = std::make_unique<Population>();
+
+    for (SizeType neuronId = 0; neuronId < relocatedNeuronsById.size(); ++neuronId) {
+        population->addNeuron(std::move(relocatedNeuronsById[neuronId]), source->getCellLocation(neuronId));
+    }
+
+    for (auto neuronId : storageOrder) {
+        const auto& sourceNeuron = source->getNeuronById(neuronId);
+        auto& relocatedNeuron = population->getNeuronById(neuronId);
+
+        for (auto synIt = sourceNeuron.cbeginOutboundSynapses(); synIt != sourceNeuron.cendOutboundSynapses(); ++synIt) {
+            const Synapse& sourceSynapse = **synIt;
+
+            auto synapse = factory.makeSynapse(
+                    sourceSynapse.synapseParams,
+                    &relocatedNeuron,
+                    &population->getNeuronById(sourceSynapse.postSynapticNeuron->getNeuronId()),
+                    sourceSynapse.conductionDelay,
+                    sourceSynapse.weight);
+
+            relocatedNeuron.addOutboundSynapse(synapse.get());
+
+            if (sourceNeuron.getNeuronParams()->isInhibitory) {
+                population->addInhibitorySynapse(std::move(synapse));
+            } else {
+                population->addExcitatorySynapse(std::move(synapse));
+            }
+        }
+
+        for (auto sourceIt = sourceNeuron.cbeginInhibitionSources(); sourceIt != sourceNeuron.cendInhibitionSources(); ++sourceIt) {
+            relocatedNeuron.addContinuousInhibitionSource(&population->getNeuronById((*sourceIt)->getNeuronId()));
+        }
+    }
+
+    auto channelProjector = source->releaseChannelProjector();
+    channelProjector->rebindTargetNeurons(*population);
+    population->setChannelProjector(std::move(channelProjector));
+
+    return population;
+}
+
+}
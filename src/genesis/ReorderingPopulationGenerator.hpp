@@ -0,0 +1,24 @@
+#pragma once
+
+#include "PopulationGenerator.hpp"
+#include "NeuronOrdering.hpp"
+
+namespace soft_npu {
+
+// Decorates another generator: the generated population is relocated such that neurons (and their outbound synapses)
+// are allocated in the order given by the ordering function. Neuron ids, synapse order per neuron and the channel
+// projector are preserved, so recordings and exports are unaffected.
+class ReorderingPopulationGenerator : public PopulationGenerator {
+public:
+    ReorderingPopulationGenerator(
+            std::unique_ptr<PopulationGenerator> generator,
+            NeuronOrdering::OrderingFunction orderingFunction);
+
+    std::unique_ptr<Population> generatePopulation() override;
+
+private:
+    std::unique_ptr<PopulationGenerator> generator;
+    NeuronOrdering::OrderingFunction orderingFunction;
+};
+
+}
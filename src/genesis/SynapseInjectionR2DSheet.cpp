@@ -1,15 +1,14 @@
 #include "SynapseInjectionR2DSheet.hpp"
-#include "NeuroComponentsFactory.hpp"
 #include <boost/functional/hash.hpp>
-#include <params/ParamsFactories.hpp>
-#include <unordered_set>
+#include <util/CounterBasedRandomEngine.hpp>
+#include <unordered_map>
 
 namespace soft_npu::SynapseInjectionR2DSheet {
 
 using GridLocation = std::pair<SizeType, SizeType>;
 
 Population::Location getTargetLocation(
-        RandomEngineType& randomEngine,
+        CounterBasedRandomEngine& randomEngine,
         const Population::Location& sourceLocation,
         bool distantLocation,
         ValueType minDistance,
@@ -36,11 +35,15 @@ Population::Location getTargetLocation(
     }
 }
 
-void doInjectSynapses(
-        std::shared_ptr<const SynapseParams> synapseParams,
-        RandomEngineType& randomEngine,
-        NeuroComponentsFactory& factory,
-        Population& population,
+// the stream step distinguishes the streams of the projections of one neuron, step 0 being its location
+void doDrawSynapseSpecs(
+        std::vector<std::vector<SynapseSpec>>& synapseSpecsByPreSynapticNeuronId,
+        std::vector<SizeType>& numSynapsesByPreSynapticNeuronId,
+        uint64_t seed,
+        uint32_t streamStep,
+        const std::vector<Population::Location>& locationsByNeuronId,
+        const std::vector<bool>& isInhibitoryByNeuronId,
+        const std::function<bool(SizeType)>& isTarget,
         bool inhibitorySource,
         bool distantLocation,
         ValueType minDistance,
@@ -53,16 +56,18 @@ void doInjectSynapses(
 
 
     std::uniform_real_distribution<TimeType> uniformDistribution;
-    std::unordered_map<GridLocation, std::vector<Neuron*>, boost::hash<GridLocation>> gridLocationToNeurons;
+    std::unordered_map<GridLocation, std::vector<SizeType>, boost::hash<GridLocation>> gridLocationToNeuronIds;
 
     const static ValueType gridSpacingFactor = std::sqrt(2.0) / (std::sqrt(2.0) - 1);
 
     SizeType gridDim = std::floor(1.0 / (gridSpacingFactor * projectionRadius));
     ValueType gridSpacing = 1.0 / gridDim;
 
-    for (auto neuronIt = population.cbeginNeurons(); neuronIt != population.cendNeurons(); ++ neuronIt) {
+    const SizeType numNeurons = locationsByNeuronId.size();
 
-        auto sourceLocation = population.getCellLocation((*neuronIt)->getNeuronId());
+    for (SizeType neuronId = 0; neuronId < numNeurons; ++ neuronId) {
+
+        auto sourceLocation = locationsByNeuronId[neuronId];
 
         SizeType xGridLocation = (static_cast<SizeType>(std::floor(sourceLocation[0] / gridSpacing - 0.5)) + gridDim) % gridDim;
         SizeType yGridLocation = (static_cast<SizeType>(std::floor(sourceLocation[1] / gridSpacing - 0.5)) + gridDim) % gridDim;
@@ -78,25 +83,23 @@ void doInjectSynapses(
         };
 
         for (const auto& gridLocation : relevantGridLocations) {
-            auto gridIt = gridLocationToNeurons.find(gridLocation);
-
-            if (gridIt == gridLocationToNeurons.end()) {
-                gridIt = gridLocationToNeurons.emplace_hint(gridIt, gridLocation, std::vector<Neuron*>());
-            }
-
-            gridIt->second.push_back((*neuronIt).get());
+            gridLocationToNeuronIds[gridLocation].push_back(neuronId);
         }
     }
 
-    for (auto neuronIt = population.cbeginNeurons(); neuronIt != population.cendNeurons(); ++ neuronIt) {
-
-        auto& sourceNeuron = **neuronIt;
+    for (SizeType sourceNeuronId = 0; sourceNeuronId < numNeurons; ++ sourceNeuronId) {
 
-        if (inhibitorySource ^ sourceNeuron.getNeuronParams()->isInhibitory) {
+        if (inhibitorySource ^ isInhibitoryByNeuronId[sourceNeuronId]) {
             continue;
         }
 
-        auto sourceLocation = population.getCellLocation(sourceNeuron.getNeuronId());
+        CounterBasedRandomEngine randomEngine(
+                seed,
+                CounterBasedRandomEngine::Subsystem::populationGeneration,
+                static_cast<uint32_t>(sourceNeuronId),
+                streamStep);
+
+        auto sourceLocation = locationsByNeuronId[sourceNeuronId];
         auto targetLocation = getTargetLocation(randomEngine, sourceLocation, distantLocation, minDistance, projectionRadius);
 
         SizeType xGridLocation = static_cast<SizeType>(targetLocation[0] / gridSpacing) % gridDim;
@@ -104,44 +107,41 @@ void doInjectSynapses(
 
         GridLocation targetGridLocation(xGridLocation, yGridLocation);
 
-        auto gridIt = gridLocationToNeurons.find(targetGridLocation);
+        auto gridIt = gridLocationToNeuronIds.find(targetGridLocation);
 
-        if (gridIt != gridLocationToNeurons.end()) {
-            auto& candidateNeurons = gridIt->second;
+        if (gridIt != gridLocationToNeuronIds.end()) {
+            auto& candidateNeuronIds = gridIt->second;
 
-            std::vector<SizeType> indices(candidateNeurons.size());
+            std::vector<SizeType> indices(candidateNeuronIds.size());
             std::iota(indices.begin(), indices.end(), 0);
             std::shuffle(indices.begin(), indices.end(), randomEngine);
 
+            auto& synapseIndex = numSynapsesByPreSynapticNeuronId[sourceNeuronId];
+
             SizeType synapseCount = 0;
             for (SizeType index : indices) {
                 if (synapseCount >= numTargets) {
                     break;
                 }
 
-                auto candidateLocation = population.getCellLocation(candidateNeurons[index]->getNeuronId());
+                auto candidateNeuronId = candidateNeuronIds[index];
+                auto candidateLocation = locationsByNeuronId[candidateNeuronId];
 
                 bool withinRange = PopulationUtils::isDistanceShorterThan(targetLocation, candidateLocation, projectionRadius);
 
-                bool isEligible = withinRange && candidateNeurons[index]->getNeuronId() != sourceNeuron.getNeuronId();
+                bool isEligible = withinRange && candidateNeuronId != sourceNeuronId;
 
                 if (isEligible) {
 
-                    auto targetNeuron = candidateNeurons[index];
-
                     TimeType conductionDelay = conductionDelayDeterministicPart +
                             uniformDistribution(randomEngine) * conductionDelayRandomPart;
 
-                    auto synapse = factory.makeSynapse(synapseParams, &sourceNeuron, targetNeuron, conductionDelay, initialWeight);
-
-                    sourceNeuron.addOutboundSynapse(synapse.get());
-
-                    if (sourceNeuron.getNeuronParams()->isInhibitory) {
-                        population.addInhibitorySynapse(std::move(synapse));
-                    } else {
-                        population.addExcitatorySynapse(std::move(synapse));
+                    if (isTarget(candidateNeuronId)) {
+                        synapseSpecsByPreSynapticNeuronId[sourceNeuronId].push_back(
+                                {candidateNeuronId, conductionDelay, initialWeight, synapseIndex});
                     }
 
+                    ++ synapseIndex;
                     ++ synapseCount;
                 }
             }
@@ -149,11 +149,11 @@ void doInjectSynapses(
     }
 }
 
-void injectSynapses(
-        const soft_npu::ParamsType &params,
-        RandomEngineType &randomEngine,
-        NeuroComponentsFactory& factory,
-        Population &population) {
+std::vector<std::vector<SynapseSpec>> drawSynapseSpecs(
+        const ParamsType& params,
+        const std::vector<Population::Location>& locationsByNeuronId,
+        const std::vector<bool>& isInhibitoryByNeuronId,
+        const std::function<bool(SizeType)>& isTarget) {
     auto generatorParams = params["populationGenerators"]["r2dSheet"];
     ValueType pctExcLongDistanceTargets = generatorParams["pctExcLongDistanceTargets"];
     ValueType radiusExcShort = generatorParams["radiusExcShort"];
@@ -173,13 +173,19 @@ void injectSynapses(
     SizeType numDistantExcTargets = numTargetsExc * pctExcLongDistanceTargets;
     SizeType numNearbyExcTargets = numTargetsExc - numDistantExcTargets;
 
-    auto synapseParams = ParamsFactories::extractSynapseParams(params);
+    const uint64_t seed = params["simulation"]["seed"];
+
+    std::vector<std::vector<SynapseSpec>> synapseSpecsByPreSynapticNeuronId(locationsByNeuronId.size());
+    std::vector<SizeType> numSynapsesByPreSynapticNeuronId(locationsByNeuronId.size(), 0);
 
-    doInjectSynapses(
-            synapseParams,
-            randomEngine,
-            factory,
-            population,
+    doDrawSynapseSpecs(
+            synapseSpecsByPreSynapticNeuronId,
+            numSynapsesByPreSynapticNeuronId,
+            seed,
+            1,
+            locationsByNeuronId,
+            isInhibitoryByNeuronId,
+            isTarget,
             false,
             false,
             0,
@@ -189,11 +195,14 @@ void injectSynapses(
             maxExcConductionDelay - std::numeric_limits<ValueType>::epsilon(),
             excitatorySynapseInitialWeight);
 
-    doInjectSynapses(
-            synapseParams,
-            randomEngine,
-            factory,
-            population,
+    doDrawSynapseSpecs(
+            synapseSpecsByPreSynapticNeuronId,
+            numSynapsesByPreSynapticNeuronId,
+            seed,
+            2,
+            locationsByNeuronId,
+            isInhibitoryByNeuronId,
+            isTarget,
             false,
             true,
             radiusExcShort,
@@ -203,11 +212,14 @@ void injectSynapses(
             maxExcConductionDelay - std::numeric_limits<ValueType>::epsilon(),
             excitatorySynapseInitialWeight);
 
-    doInjectSynapses(
-            synapseParams,
-            randomEngine,
-            factory,
-            population,
+    doDrawSynapseSpecs(
+            synapseSpecsByPreSynapticNeuronId,
+            numSynapsesByPreSynapticNeuronId,
+            seed,
+            3,
+            locationsByNeuronId,
+            isInhibitoryByNeuronId,
+            isTarget,
             true,
             false,
             0,
@@ -216,6 +228,8 @@ void injectSynapses(
             inhibitoryConductionDelayDeterministicPart,
             inhibitoryConductionDelayRandomPart,
             inhibitorySynapseWeight);
+
+    return synapseSpecsByPreSynapticNeuronId;
 }
 
 }
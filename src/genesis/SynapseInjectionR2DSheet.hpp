@@ -1,16 +1,27 @@
 #pragma once
 
-#include <memory>
+#include <functional>
+#include <vector>
 #include <neuro/Population.hpp>
-#include "NeuroComponentsFactory.hpp"
 
 namespace soft_npu::SynapseInjectionR2DSheet {
 
-void injectSynapses(
+struct SynapseSpec {
+    SizeType postSynapticNeuronId;
+    TimeType conductionDelay;
+    ValueType initialWeight;
+
+    // among all outbound synapses of the pre-synaptic neuron
+    SizeType synapseIndex;
+};
+
+// The synapses of all pre-synaptic neurons of the sheet onto the post-synaptic neurons accepted by isTarget, indexed by
+// pre-synaptic neuron id. Each neuron draws from its own streams and all random numbers are drawn regardless, so that
+// the synapses do not depend on the accepted neurons.
+std::vector<std::vector<SynapseSpec>> drawSynapseSpecs(
         const ParamsType& params,
-        RandomEngineType& randomEngine,
-        NeuroComponentsFactory& factory,
-        Population& population
+        const std::vector<Population::Location>& locationsByNeuronId,
+        const std::vector<bool>& isInhibitoryByNeuronId,
+        const std::function<bool(SizeType)>& isTarget
         );
 }
-
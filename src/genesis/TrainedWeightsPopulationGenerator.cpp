@@ -0,0 +1,40 @@
+#include "TrainedWeightsPopulationGenerator.hpp"
+#include <neuro/Synapse.hpp>
+#include <stdexcept>
+
+namespace soft_npu {
+
+TrainedWeightsPopulationGenerator::TrainedWeightsPopulationGenerator(
+        std::unique_ptr<PopulationGenerator> generator,
+        std::vector<SynapseInfo> trainedSynapseInfos) :
+    generator(std::move(generator)),
+    trainedSynapseInfos(std::move(trainedSynapseInfos)) {
+}
+
+std::unique_ptr<Population> TrainedWeightsPopulationGenerator::generatePopulation() {
+
+    auto population = generator->generatePopulation();
+    auto synapseInfoIt = trainedSynapseInfos.cbegin();
+
+    for (auto neuronIt = population->cbeginNeurons(); neuronIt != population->cendNeurons(); ++neuronIt) {
+        const auto& neuron = **neuronIt;
+
+        for (auto synIt = neuron.cbeginOutboundSynapses(); synIt != neuron.cendOutboundSynapses(); ++synIt, ++synapseInfoIt) {
+            if (synapseInfoIt == trainedSynapseInfos.cend() ||
+                    synapseInfoIt->preSynapticNeuronId != neuron.getNeuronId() ||
+                    synapseInfoIt->postSynapticNeuronId != (*synIt)->postSynapticNeuron->getNeuronId()) {
+                throw std::runtime_error("Trained synapses do not match the generated population");
+            }
+
+            (*synIt)->weight = synapseInfoIt->weight;
+        }
+    }
+
+    if (synapseInfoIt != trainedSynapseInfos.cend()) {
+        throw std::runtime_error("Trained synapses do not match the generated population");
+    }
+
+    return population;
+}
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "PopulationGenerator.hpp"
+#include <core/SynapseInfo.hpp>
+#include <vector>
+
+namespace soft_npu {
+
+// Decorates another generator: the weights of the generated population are replaced by trained ones, such as the
+// final synapse infos of a simulation result of the same generator and seed. The synapse infos must list the outbound
+// synapses of all neurons in the order of the population.
+class TrainedWeightsPopulationGenerator : public PopulationGenerator {
+public:
+    TrainedWeightsPopulationGenerator(
+            std::unique_ptr<PopulationGenerator> generator,
+            std::vector<SynapseInfo> trainedSynapseInfos);
+
+    std::unique_ptr<Population> generatePopulation() override;
+
+private:
+    std::unique_ptr<PopulationGenerator> generator;
+    std::vector<SynapseInfo> trainedSynapseInfos;
+};
+
+}
@@ -1,4 +1,5 @@
 #include "ChannelProjector.hpp"
+#include "Population.hpp"
 
 namespace soft_npu {
 
@@ -9,8 +10,37 @@ void ChannelProjector::projectChannelSpike(const CycleContext& ctx, SizeType cha
         ValueType epsp = epspWithTargetNeuron.first;
         auto targetNeuron = epspWithTargetNeuron.second;
 
-        ctx.staticContext.eventProcessor.pushImmediateTransmissionEvent(epsp, *targetNeuron);
+        ctx.staticContext.eventProcessor.pushImmediateTransmissionEvent(epsp, targetNeuron);
     }
 }
 
-}
\ No newline at end of file
+void ChannelProjector::rebindTargetNeurons(
+        std::unordered_map<SizeType, ChannelSpikeProjectionResult>& channelIdToResult,
+        const Population& population) {
+
+    for (auto& entry : channelIdToResult) {
+        for (auto& epspWithTargetNeuron : entry.second) {
+            if (epspWithTargetNeuron.second != nullptr) {
+                epspWithTargetNeuron.second = &population.getNeuronById(epspWithTargetNeuron.second->getNeuronId());
+            }
+        }
+    }
+}
+
+std::unordered_set<SizeType> ChannelProjector::getTargetNeuronIds(
+        const std::unordered_map<SizeType, ChannelSpikeProjectionResult>& channelIdToResult) {
+
+    std::unordered_set<SizeType> targetNeuronIds;
+
+    for (const auto& entry : channelIdToResult) {
+        for (const auto& epspWithTargetNeuron : entry.second) {
+            if (epspWithTargetNeuron.second != nullptr) {
+                targetNeuronIds.insert(epspWithTargetNeuron.second->getNeuronId());
+            }
+        }
+    }
+
+    return targetNeuronIds;
+}
+
+}
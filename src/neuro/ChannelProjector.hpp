@@ -3,10 +3,13 @@
 #include <core/EventProcessor.hpp>
 #include <core/CycleOutputBuffer.hpp>
 #include <unordered_set>
+#include <unordered_map>
 #include <boost/core/noncopyable.hpp>
 
 namespace soft_npu {
 
+class Population;
+
 struct ChannelProjector : private boost::noncopyable {
 
     virtual ~ChannelProjector() = default;
@@ -15,8 +18,21 @@ struct ChannelProjector : private boost::noncopyable {
     virtual std::vector<std::pair<ValueType, Neuron*>> getEPSPsWithTargetNeurons(SizeType channelId) const = 0;
     virtual std::unordered_set<SizeType> getMotorNeuronIds() const = 0;
 
+    // target neurons of the input channels
+    virtual std::unordered_set<SizeType> getSensoryNeuronIds() const = 0;
+
+    // re-points all target neurons to the neurons with the same ids in the given population
+    virtual void rebindTargetNeurons(const Population& population) = 0;
+
 protected:
     using ChannelSpikeProjectionResult = std::vector<std::pair<ValueType, Neuron*>>;
+
+    static void rebindTargetNeurons(
+            std::unordered_map<SizeType, ChannelSpikeProjectionResult>& channelIdToResult,
+            const Population& population);
+
+    static std::unordered_set<SizeType> getTargetNeuronIds(
+            const std::unordered_map<SizeType, ChannelSpikeProjectionResult>& channelIdToResult);
 };
 
 }
@@ -0,0 +1,45 @@
+#include "ContinuousInhibition.hpp"
+#include "Neuron.hpp"
+#include <algorithm>
+
+namespace soft_npu {
+
+ContinuousInhibition::ContinuousInhibition(std::vector<Neuron*> sources) :
+        sources(std::move(sources)),
+        lastSourceSpikeTime(std::numeric_limits<TimeType>::lowest()),
+        cachedTime(0),
+        cachedInhibition(0),
+        isValid(false) {
+
+    for (auto source : this->sources) {
+        lastSourceSpikeTime = std::max(source->getLastSpikeTime(), lastSourceSpikeTime);
+    }
+}
+
+void ContinuousInhibition::onSourceSpike(TimeType spikeTime) noexcept {
+    lastSourceSpikeTime = std::max(spikeTime, lastSourceSpikeTime);
+    isValid = false;
+
+    // the subscribers' own membrane voltages depend on the last source spike time
+    for (auto subscriber : subscribers) {
+        subscriber->invalidateInhibitionsAsSource();
+    }
+}
+
+void ContinuousInhibition::addSubscriber(Neuron* subscriber) {
+    subscribers.push_back(subscriber);
+}
+
+void ContinuousInhibition::evaluate(TimeType time) noexcept {
+    cachedInhibition = 0;
+
+    for (auto source : sources) {
+        source->update(time);
+        cachedInhibition += source->getMembraneVoltage(time);
+    }
+
+    cachedTime = time;
+    isValid = true;
+}
+
+}
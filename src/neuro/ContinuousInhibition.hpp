@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <limits>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+
+namespace soft_npu {
+
+class Neuron;
+
+// Summed membrane voltage of a set of continuous inhibition sources, shared by all neurons subscribing to the
+// same set. The sum is evaluated once per time and reused until a source's state changes.
+class ContinuousInhibition : private boost::noncopyable {
+public:
+    explicit ContinuousInhibition(std::vector<Neuron*> sources);
+
+    ValueType getInhibition(TimeType time) {
+        if (!isValid || time != cachedTime) {
+            evaluate(time);
+        }
+
+        return cachedInhibition;
+    }
+
+    TimeType getLastSourceSpikeTime() const noexcept {
+        return lastSourceSpikeTime;
+    }
+
+    void invalidate() noexcept {
+        isValid = false;
+    }
+
+    void onSourceSpike(TimeType spikeTime) noexcept;
+    void addSubscriber(Neuron* subscriber);
+
+private:
+    void evaluate(TimeType time) noexcept;
+
+    std::vector<Neuron*> sources;
+    std::vector<Neuron*> subscribers;
+    TimeType lastSourceSpikeTime;
+    TimeType cachedTime;
+    ValueType cachedInhibition;
+    bool isValid;
+};
+
+}
@@ -42,4 +42,12 @@ std::unordered_set<SizeType> ExplicitChannelProjector::getMotorNeuronIds() const
     return rv;
 }
 
+std::unordered_set<SizeType> ExplicitChannelProjector::getSensoryNeuronIds() const {
+    return getTargetNeuronIds(channelIdToResult);
+}
+
+void ExplicitChannelProjector::rebindTargetNeurons(const Population& population) {
+    ChannelProjector::rebindTargetNeurons(channelIdToResult, population);
+}
+
 }
@@ -14,6 +14,8 @@ public:
     void projectNeuronSpike(CycleOutputBuffer& cycleOutputBuffer, const Neuron& spikingNeuron) const override;
     ChannelSpikeProjectionResult getEPSPsWithTargetNeurons(SizeType channelId) const override;
     std::unordered_set<SizeType> getMotorNeuronIds() const override;
+    std::unordered_set<SizeType> getSensoryNeuronIds() const override;
+    void rebindTargetNeurons(const Population& population) override;
 
 private:
     std::unordered_map<SizeType, ChannelSpikeProjectionResult> channelIdToResult;
@@ -5,12 +5,13 @@
 #include <core/EventProcessor.hpp>
 #include <core/TransmissionEvent.hpp>
 #include <core/SynapticTransmissionStats.hpp>
+#include <core/CycleOutputBuffer.hpp>
 
 namespace soft_npu {
 
 Neuron::Neuron(SizeType neuronId, std::shared_ptr<const NeuronParams> neuronParams) noexcept :
-        neuronParams(neuronParams), neuronId(neuronId), lastTime(0), lastVoltage(0),
-        lastSpikeTime(std::numeric_limits<TimeType>::lowest()) {
+        continuousInhibition(nullptr), neuronParams(neuronParams), neuronId(neuronId), lastTime(0), lastVoltage(0),
+        lastSpikeTime(std::numeric_limits<TimeType>::lowest()), isThresholdEvalPending(false) {
 }
 
 std::shared_ptr<const NeuronParams> Neuron::getNeuronParams() const noexcept {
@@ -29,20 +30,36 @@ void Neuron::addContinuousInhibitionSource(Neuron * source) {
     continuousInhibitionSources.push_back(source);
 }
 
+void Neuron::bindContinuousInhibition(ContinuousInhibition* inhibition) noexcept {
+    continuousInhibition = inhibition;
+}
+
+void Neuron::addInhibitionAsSource(ContinuousInhibition* inhibition) {
+    inhibitionsAsSource.push_back(inhibition);
+}
+
+void Neuron::unbindContinuousInhibitions() noexcept {
+    continuousInhibition = nullptr;
+    inhibitionsAsSource.clear();
+}
+
 void Neuron::pushThresholdEvalEvent(const CycleContext& ctx) {
     ctx.staticContext.eventProcessor.pushFiringThresholdEvalEvent(*this);
 }
 
 void Neuron::processInboundOnSpike(const CycleContext& cycleContext) {
-    for (const auto& synapticTransmissionInfo : synapticTransmissionSTDPBuffer) {
+    synapticTransmissionSTDPBuffer.forEach([&cycleContext](const SynapticTransmissionInfo& synapticTransmissionInfo) {
         synapticTransmissionInfo.synapse->handleSTDP(cycleContext, cycleContext.time, synapticTransmissionInfo.transmissionTime);
-    }
+    });
 
     synapticTransmissionSTDPBuffer.clear();
 }
 
 void Neuron::registerInboundSynapticTransmission(const CycleContext& cycleContext, Synapse* synapse) {
-    synapticTransmissionSTDPBuffer.emplace_back(synapse, cycleContext.time);
+    // entries outside the STDP window can no longer pair with a future spike
+    synapticTransmissionSTDPBuffer.evictAndEmplace([&cycleContext](const SynapticTransmissionInfo& synapticTransmissionInfo) {
+        return !synapticTransmissionInfo.synapse->isWithinSTDPWindow(cycleContext.time, synapticTransmissionInfo.transmissionTime);
+    }, synapse, cycleContext.time);
 }
 
 void Neuron::processOutboundOnSpike(const CycleContext& cycleContext) {
@@ -59,20 +76,31 @@ void Neuron::processOutboundOnSpike(const CycleContext& cycleContext) {
     }
 }
 
+template<bool isPlastic>
 void Neuron::fire(const CycleContext& cycleContext) noexcept {
 
     lastVoltage = neuronParams->resetVoltage;
     lastTime = cycleContext.time + neuronParams->refractoryPeriod;
     lastSpikeTime = cycleContext.time;
 
-    processInboundOnSpike(cycleContext);
+    for (auto inhibition : inhibitionsAsSource) {
+        inhibition->onSourceSpike(lastSpikeTime);
+    }
+
+    if constexpr (isPlastic) {
+        processInboundOnSpike(cycleContext);
+    }
+
     processOutboundOnSpike(cycleContext);
 
-    cycleContext.staticContext.population.onSpike(cycleContext, *this);
+    cycleContext.staticContext.cycleOutputBuffer.addNeuronSpike(neuronId);
 
     cycleContext.staticContext.synapticTransmissionStats.increaseTransmissionCount(outboundSynapses.size());
 }
 
+template void Neuron::fire<true>(const CycleContext&) noexcept;
+template void Neuron::fire<false>(const CycleContext&) noexcept;
+
 Neuron::SynapticTransmissionInfo::SynapticTransmissionInfo(Synapse *synapse, TimeType transmissionTime) : synapse(
         synapse), transmissionTime(transmissionTime) {}
 }
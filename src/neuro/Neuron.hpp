@@ -2,6 +2,8 @@
 
 #include <core/CycleContext.hpp>
 #include "NeuronParams.hpp"
+#include "ContinuousInhibition.hpp"
+#include <core/TimeWindowedRingBuffer.hpp>
 #include <memory>
 #include <vector>
 #include <boost/core/noncopyable.hpp>
@@ -22,6 +24,7 @@ public:
 
             // epsp override scaling is experimental. May be refined later.
             lastVoltage = std::max(lastVoltage + epsp * neuronParams->epspOverrideScaleFactor, neuronParams->voltageFloor);
+            invalidateInhibitionsAsSource();
 
             if (lastVoltage >= neuronParams->thresholdVoltage) {
                 pushThresholdEvalEvent(cycleContext);
@@ -29,10 +32,13 @@ public:
         }
     }
 
-    void fireIfAboveThreshold(const CycleContext& ctx, TimeType time) {
+    template<bool isPlastic = true>
+    bool fireIfAboveThreshold(const CycleContext& ctx, TimeType time) {
 
         auto compareVoltage = lastVoltage;
-        if (!continuousInhibitionSources.empty()) {
+        if (continuousInhibition != nullptr) {
+            compareVoltage -= continuousInhibition->getInhibition(time);
+        } else if (!continuousInhibitionSources.empty()) {
             ValueType continuousInhibition = 0;
 
             for (auto source : continuousInhibitionSources) {
@@ -44,26 +50,77 @@ public:
         }
 
         if (compareVoltage >= neuronParams->thresholdVoltage) {
-            fire(ctx);
+            fire<isPlastic>(ctx);
+            return true;
         }
+
+        return false;
+    }
+
+    // A neuron with continuous inhibition can become suprathreshold when a source fires during the threshold stage,
+    // so each of its threshold crossings stays a separate candidate. Returns whether the neuron needs to be queued.
+    bool markThresholdEvalPending() noexcept {
+        if (isThresholdEvalPending && continuousInhibitionSources.empty()) {
+            return false;
+        }
+
+        isThresholdEvalPending = true;
+        return true;
+    }
+
+    void clearThresholdEvalPending() noexcept {
+        isThresholdEvalPending = false;
+    }
+
+    bool hasContinuousInhibition() const noexcept {
+        return !continuousInhibitionSources.empty();
+    }
+
+    ValueType getLastVoltage() const noexcept {
+        return lastVoltage;
     }
 
+    ValueType getThresholdVoltage() const noexcept {
+        return neuronParams->thresholdVoltage;
+    }
+
+    // without plasticity, the spike is not paired with inbound transmissions for STDP
+    template<bool isPlastic = true>
+    void fire(const CycleContext& cycleContext) noexcept;
+
     void addOutboundSynapse(Synapse* synapse);
     void addContinuousInhibitionSource(Neuron * source);
 
+    // set up by Population::bindContinuousInhibitions
+    void bindContinuousInhibition(ContinuousInhibition* inhibition) noexcept;
+    void addInhibitionAsSource(ContinuousInhibition* inhibition);
+    void unbindContinuousInhibitions() noexcept;
+
+    const ContinuousInhibition* getContinuousInhibition() const noexcept {
+        return continuousInhibition;
+    }
+
+    void invalidateInhibitionsAsSource() noexcept {
+        for (auto inhibition : inhibitionsAsSource) {
+            inhibition->invalidate();
+        }
+    }
+
     ValueType getMembraneVoltage(TimeType time) const noexcept {
 
         if (time == lastTime) {
             return lastVoltage;
         } else {
 
-            auto lastSourceSpikeTime = std::accumulate(
-                    continuousInhibitionSources.cbegin(),
-                    continuousInhibitionSources.cend(),
-                    std::numeric_limits<TimeType>::lowest(),
-                    [](TimeType time, const Neuron* source) {
-                        return std::max(source->lastSpikeTime, time);
-                    });
+            auto lastSourceSpikeTime = continuousInhibition != nullptr ?
+                    continuousInhibition->getLastSourceSpikeTime() :
+                    std::accumulate(
+                        continuousInhibitionSources.cbegin(),
+                        continuousInhibitionSources.cend(),
+                        std::numeric_limits<TimeType>::lowest(),
+                        [](TimeType time, const Neuron* source) {
+                            return std::max(source->lastSpikeTime, time);
+                        });
 
             if (lastSourceSpikeTime < lastTime) {
                 TimeType timeSinceLastEvaluation = time - lastTime;
@@ -102,24 +159,30 @@ public:
     }
 
 private:
+    friend class ContinuousInhibition;
 
     struct SynapticTransmissionInfo {
 
+        SynapticTransmissionInfo() = default;
         SynapticTransmissionInfo(Synapse *synapse, TimeType transmissionTime);
 
         Synapse* synapse;
         TimeType transmissionTime;
     };
 
-    std::vector<SynapticTransmissionInfo> synapticTransmissionSTDPBuffer;
+    // allocated on the first plastic transmission, so never in inference mode
+    TimeWindowedRingBuffer<SynapticTransmissionInfo> synapticTransmissionSTDPBuffer;
     std::vector<Synapse*> outboundSynapses;
     std::vector<Neuron*> continuousInhibitionSources;
+    ContinuousInhibition* continuousInhibition;
+    std::vector<ContinuousInhibition*> inhibitionsAsSource;
     std::shared_ptr<const NeuronParams> neuronParams;
 
     const SizeType neuronId;
     TimeType lastTime;
     ValueType lastVoltage;
     TimeType lastSpikeTime;
+    bool isThresholdEvalPending;
 
     void pushThresholdEvalEvent(const CycleContext&);
 
@@ -132,7 +195,6 @@ private:
         lastTime = time;
     }
 
-    void fire(const CycleContext& cycleContext) noexcept;
     void processInboundOnSpike(const CycleContext& cycleContext);
     void processOutboundOnSpike(const CycleContext& cycleContext);
 };
@@ -45,7 +45,7 @@ OneToManyChannelProjector::OneToManyChannelProjector(const ParamsType& params,
         std::transform(
                 neuronIds.cbegin(), neuronIds.cend(),
                 std::back_inserter(projectionResult), [&population, epsp](SizeType neuronId) {
-            return std::make_pair(epsp, &population.getNeuronById(neuronId));
+            return std::make_pair(epsp, population.isLocal(neuronId) ? &population.getNeuronById(neuronId) : nullptr);
         });
     }
 }
@@ -77,4 +77,12 @@ std::unordered_set<SizeType> OneToManyChannelProjector::getMotorNeuronIds() cons
     return rv;
 }
 
+std::unordered_set<SizeType> OneToManyChannelProjector::getSensoryNeuronIds() const {
+    return getTargetNeuronIds(channelIdToResult);
+}
+
+void OneToManyChannelProjector::rebindTargetNeurons(const Population& population) {
+    ChannelProjector::rebindTargetNeurons(channelIdToResult, population);
+}
+
 }
@@ -8,10 +8,11 @@ OneToOneChannelProjector::OneToOneChannelProjector(
         const Population& population) {
     ValueType epsp = params["channelProjectors"]["OneToOne"]["epsp"];
 
-    for (auto it = population.cbeginNeurons(); it != population.cendNeurons(); ++ it) {
-        auto neuron = (*it).get();
+    // the neurons of other partitions are kept as null targets, so that channel ids stay neuron ids
+    for (SizeType neuronId = 0; neuronId < population.getPopulationSize(); ++ neuronId) {
+        auto neuron = population.isLocal(neuronId) ? &population.getNeuronById(neuronId) : nullptr;
         ChannelSpikeProjectionResult projectionResult({{epsp, neuron}});
-        channelIdToResult.emplace(neuron->getNeuronId(), projectionResult);
+        channelIdToResult.emplace(neuronId, projectionResult);
     }
 }
 
@@ -36,4 +37,13 @@ std::unordered_set<SizeType> OneToOneChannelProjector::getMotorNeuronIds() const
 
     return rv;
 }
+
+std::unordered_set<SizeType> OneToOneChannelProjector::getSensoryNeuronIds() const {
+    return getTargetNeuronIds(channelIdToResult);
+}
+
+void OneToOneChannelProjector::rebindTargetNeurons(const Population& population) {
+    ChannelProjector::rebindTargetNeurons(channelIdToResult, population);
+}
+
 }
@@ -9,6 +9,8 @@ public:
     OneToOneChannelProjector(const ParamsType& params, const Population& population);
     void projectNeuronSpike(CycleOutputBuffer& cycleOutputBuffer, const Neuron& spikingNeuron) const override;
     std::unordered_set<SizeType> getMotorNeuronIds() const override;
+    std::unordered_set<SizeType> getSensoryNeuronIds() const override;
+    void rebindTargetNeurons(const Population& population) override;
 
 protected:
     ChannelSpikeProjectionResult getEPSPsWithTargetNeurons(SizeType channelId) const override;
@@ -2,17 +2,31 @@
 #include "Synapse.hpp"
 #include <params/ParamsFactories.hpp>
 #include "neuro/ChannelProjector.hpp"
+#include <algorithm>
+#include <map>
 
 namespace soft_npu {
 
-void Population::onSpike(const CycleContext& cycleContext, const Neuron& neuron) const {
+void Population::onCycleSpikes(const CycleContext& cycleContext, const std::vector<SizeType>& spikingNeuronIds) const {
+
+    if (spikingNeuronIds.empty()) {
+        return;
+    }
 
     if (channelProjector != nullptr) {
-        channelProjector->projectNeuronSpike(cycleContext.staticContext.cycleOutputBuffer, neuron);
+        for (auto neuronId : spikingNeuronIds) {
+            projectNeuronSpike(cycleContext.staticContext.cycleOutputBuffer, neuronId);
+        }
+    }
+
+    for (auto& entry : spikeListeners) {
+        entry.second->onSpikes(cycleContext, spikingNeuronIds);
     }
+}
 
-    for (auto& entry : spikeListenersById) {
-        entry.second->onSpike(cycleContext, neuron);
+void Population::projectNeuronSpike(CycleOutputBuffer& cycleOutputBuffer, SizeType neuronId) const {
+    if (channelProjector != nullptr) {
+        channelProjector->projectNeuronSpike(cycleOutputBuffer, *neuronsIndexedById[neuronId]);
     }
 }
 
@@ -35,6 +49,11 @@ void Population::addNeuron(std::unique_ptr<Neuron> neuron, Location location) {
     locationsIndexedByNeuronId.push_back(location);
 }
 
+void Population::addRemoteNeuron(Location location) {
+    neuronsIndexedById.push_back(nullptr);
+    locationsIndexedByNeuronId.push_back(location);
+}
+
 SizeType Population::getPopulationSize() const {
     return neuronsIndexedById.size();
 }
@@ -48,7 +67,9 @@ Population::Location Population::getCellLocation(SizeType neuronId) const {
 }
 
 void Population::removeSpikeListener(SizeType spikeListenerId) {
-    spikeListenersById.erase(spikeListenerId);
+    spikeListeners.erase(std::remove_if(spikeListeners.begin(), spikeListeners.end(), [spikeListenerId](const auto& entry) {
+        return entry.first == spikeListenerId;
+    }), spikeListeners.end());
 }
 
 void Population::projectChannelSpike(const CycleContext &ctx, SizeType channelId) const {
@@ -59,10 +80,54 @@ std::unordered_set<SizeType> Population::getMotorNeuronIds() const {
     return channelProjector->getMotorNeuronIds();
 }
 
-void Population::setChannelProjector(std::unique_ptr<const ChannelProjector> channelProjector) {
+std::unordered_set<SizeType> Population::getSensoryNeuronIds() const {
+    return channelProjector->getSensoryNeuronIds();
+}
+
+void Population::setChannelProjector(std::unique_ptr<ChannelProjector> channelProjector) {
     this->channelProjector = std::move(channelProjector);
 }
 
+std::unique_ptr<ChannelProjector> Population::releaseChannelProjector() noexcept {
+    return std::move(channelProjector);
+}
+
+void Population::bindContinuousInhibitions() {
+    for (auto& neuron : neuronsIndexedById) {
+        if (neuron != nullptr) {
+            neuron->unbindContinuousInhibitions();
+        }
+    }
+
+    continuousInhibitions.clear();
+    std::map<std::vector<Neuron*>, ContinuousInhibition*> inhibitionsBySources;
+
+    for (auto& neuron : neuronsIndexedById) {
+        if (neuron == nullptr) {
+            continue;
+        }
+
+        std::vector<Neuron*> sources(neuron->cbeginInhibitionSources(), neuron->cendInhibitionSources());
+
+        if (sources.empty()) {
+            continue;
+        }
+
+        auto& inhibition = inhibitionsBySources[sources];
+
+        if (inhibition == nullptr) {
+            continuousInhibitions.push_back(std::make_unique<ContinuousInhibition>(sources));
+            inhibition = continuousInhibitions.back().get();
+
+            for (auto source : sources) {
+                source->addInhibitionAsSource(inhibition);
+            }
+        }
+
+        inhibition->addSubscriber(neuron.get());
+        neuron->bindContinuousInhibition(inhibition);
+    }
+}
 
 namespace PopulationUtils {
 
@@ -20,23 +20,42 @@ public:
     static constexpr Location defaultLocation = {0, 0};
     using neuron_ptr_const_iterator = std::vector<std::unique_ptr<Neuron>>::const_iterator;
 
-    void onSpike(const CycleContext& cycleContext, const Neuron& neuron) const;
+    void onCycleSpikes(const CycleContext& cycleContext, const std::vector<SizeType>& spikingNeuronIds) const;
 
     template<typename T>
     SizeType addSpikeListener(T&& processingFunction) {
         auto spikeListenerId = nextSpikeListenerId ++;
-        spikeListenersById[spikeListenerId] = std::make_unique<SpikeListenerImpl<T>>(std::forward<T>(processingFunction));
+        spikeListeners.emplace_back(
+                spikeListenerId,
+                std::make_unique<SpikeListenerImpl<T>>(std::forward<T>(processingFunction)));
         return spikeListenerId;
     }
 
     std::unordered_set<SizeType> getMotorNeuronIds() const;
+    std::unordered_set<SizeType> getSensoryNeuronIds() const;
     void projectChannelSpike(const CycleContext& ctx, SizeType channelId) const;
 
+    // the output channel spikes of one neuron spike, as added at the end of each cycle; none without a channel projector
+    void projectNeuronSpike(CycleOutputBuffer& cycleOutputBuffer, SizeType neuronId) const;
+
     void removeSpikeListener(SizeType spikeListenerId);
     void addNeuron(std::unique_ptr<Neuron> neuron, Location location);
+
+    // The population of one partition of a partitioned simulation only holds the neurons of the partition. The ids of
+    // the other neurons are taken by remote neurons, which have no Neuron object and are null when iterating.
+    void addRemoteNeuron(Location location);
+
+    bool isLocal(SizeType neuronId) const noexcept {
+        return neuronsIndexedById[neuronId] != nullptr;
+    }
+
     void addExcitatorySynapse(std::unique_ptr<Synapse>);
     void addInhibitorySynapse(std::unique_ptr<Synapse>);
-    void setChannelProjector(std::unique_ptr<const ChannelProjector>);
+    void setChannelProjector(std::unique_ptr<ChannelProjector>);
+
+    // shares one continuous inhibition aggregate among all neurons with the same inhibition sources
+    void bindContinuousInhibitions();
+    std::unique_ptr<ChannelProjector> releaseChannelProjector() noexcept;
 
     neuron_ptr_const_iterator cbeginNeurons() const noexcept {
         return neuronsIndexedById.cbegin();
@@ -46,6 +65,7 @@ public:
         return neuronsIndexedById.cend();
     }
 
+    // the neuron must be local
     Neuron& getNeuronById(SizeType neuronId) const;
 
     SizeType getPopulationSize() const;
@@ -56,9 +76,10 @@ private:
     std::vector<Location> locationsIndexedByNeuronId;
     std::vector<std::unique_ptr<Synapse>> excitatorySynapses;
     std::vector<std::unique_ptr<Synapse>> inhibitorySynapses;
-    std::unique_ptr<const ChannelProjector> channelProjector;
+    std::unique_ptr<ChannelProjector> channelProjector;
+    std::vector<std::unique_ptr<ContinuousInhibition>> continuousInhibitions;
 
-    std::unordered_map<SizeType, std::unique_ptr<SpikeListener>> spikeListenersById;
+    std::vector<std::pair<SizeType, std::unique_ptr<SpikeListener>>> spikeListeners;
     SizeType nextSpikeListenerId = 0;
 };
 
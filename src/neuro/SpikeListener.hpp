@@ -1,14 +1,14 @@
 #pragma once
 
 #include <core/CycleContext.hpp>
+#include <vector>
 
 namespace soft_npu {
 
-class Neuron;
-
+// receives the ids of all neurons that spiked in a cycle, in firing order, once per cycle with at least one spike
 struct SpikeListener {
     virtual ~SpikeListener() {};
-    virtual void onSpike(const CycleContext& cycleContext, const Neuron& neuron) const = 0;
+    virtual void onSpikes(const CycleContext& cycleContext, const std::vector<SizeType>& spikingNeuronIds) const = 0;
 };
 
 template<typename F>
@@ -16,8 +16,8 @@ class SpikeListenerImpl : public SpikeListener {
 public:
     explicit SpikeListenerImpl(F&& processingFunction) : processingFunction(std::forward<F>(processingFunction)) {}
 
-    void onSpike(const CycleContext& cycleContext, const Neuron& neuron) const override {
-        processingFunction(cycleContext, neuron);
+    void onSpikes(const CycleContext& cycleContext, const std::vector<SizeType>& spikingNeuronIds) const override {
+        processingFunction(cycleContext, spikingNeuronIds);
     }
 
 private:
@@ -16,16 +16,16 @@ Synapse::Synapse(
         postSynapticNeuron(postSynapticNeuron),
         conductionDelay(conductionDelay),
         weight(initialWeight) {
-    if (preSynapticNeuron->getNeuronId() == postSynapticNeuron->getNeuronId()) {
+    if (preSynapticNeuron != nullptr && preSynapticNeuron->getNeuronId() == postSynapticNeuron->getNeuronId()) {
         throw std::runtime_error("Circular synapses are not allowed");
     }
 }
 
 void Synapse::handleSTDP(const CycleContext& ctx, TimeType postSynSpikeTime, TimeType transmissionTime) {
-    auto timePostMinusPre = postSynSpikeTime == transmissionTime ? 0.0 : postSynSpikeTime - transmissionTime;
-    if (std::abs(timePostMinusPre) < synapseParams->stdpCutOffTime) {
+    if (isWithinSTDPWindow(postSynSpikeTime, transmissionTime)) {
+        auto timePostMinusPre = postSynSpikeTime == transmissionTime ? 0.0 : postSynSpikeTime - transmissionTime;
         ValueType stdpValue = STDPRule::evaluateSTDPRule(*synapseParams, timePostMinusPre);
-        ctx.staticContext.dopaminergicModulator.createEligibilityTrace(ctx, this, stdpValue);
+        ctx.staticContext.dopaminergicModulator->createEligibilityTrace(ctx, this, stdpValue);
     }
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Aliases.hpp>
+#include <cmath>
 #include "STDPRule.hpp"
 #include <core/CycleContext.hpp>
 #include <core/StaticContext.hpp>
@@ -25,12 +26,19 @@ struct Synapse : private boost::noncopyable {
 
     ShortTermPlasticityState shortTermPlasticityState;
     std::shared_ptr<const SynapseParams> synapseParams;
+
+    // null when the pre-synaptic neuron belongs to another partition
     const Neuron* preSynapticNeuron;
     Neuron* postSynapticNeuron;
     TimeType conductionDelay;
     ValueType weight;
 
     void handleSTDP(const CycleContext&, TimeType postSynSpikeTime, TimeType transmissionTime);
+
+    bool isWithinSTDPWindow(TimeType postSynSpikeTime, TimeType transmissionTime) const noexcept {
+        auto timePostMinusPre = postSynSpikeTime == transmissionTime ? 0.0 : postSynSpikeTime - transmissionTime;
+        return std::abs(timePostMinusPre) < synapseParams->stdpCutOffTime;
+    }
 };
 
 }
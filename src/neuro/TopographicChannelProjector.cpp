@@ -29,6 +29,10 @@ TopographicChannelProjector::TopographicChannelProjector(const ParamsType& param
     for (auto it = population.cbeginNeurons(); it != population.cendNeurons(); ++it) {
         auto& neuron = *it;
 
+        if (neuron == nullptr) {
+            throw std::runtime_error("Topographic channel projector does not support partitioned populations");
+        }
+
         if (!neuron->getNeuronParams()->isInhibitory) {
             auto location = population.getCellLocation(neuron->getNeuronId());
 
@@ -86,4 +90,12 @@ std::unordered_set<SizeType> TopographicChannelProjector::getMotorNeuronIds() co
     return rv;
 }
 
+std::unordered_set<SizeType> TopographicChannelProjector::getSensoryNeuronIds() const {
+    return getTargetNeuronIds(channelIdToResult);
+}
+
+void TopographicChannelProjector::rebindTargetNeurons(const Population& population) {
+    ChannelProjector::rebindTargetNeurons(channelIdToResult, population);
+}
+
 }
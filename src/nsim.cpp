@@ -3,13 +3,15 @@
 #include <plog/Appenders/ConsoleAppender.h>
 #include <plog/Init.h>
 #include <plog/Log.h>
+#include <util/ColumnarExport.hpp>
 #include <util/FileUtil.hpp>
 #include <core/StaticInputSimulation.hpp>
 
 using namespace plog;
 using namespace soft_npu;
 
-int main()
+// usage: nsim [--csv]
+int main(int argc, char * argv[])
 {
     ConsoleAppender<plog::TxtFormatter> consoleAppender;
 
@@ -25,11 +27,18 @@ int main()
     auto simulationResult = simulation.run();
     PLOG_INFO << simulationResult;
 
-    PLOG_INFO << "Writing spike trains to csv";
-    FileUtil::writeSpikeTrainsToCSV("spikeTrains.csv", simulationResult.recordedSpikes);
-    FileUtil::writeSynapseInfosToCSV("synapseInfos.csv", simulationResult.finalSynapseInfos);
-    FileUtil::writeLocationsToCSV("locations.csv", simulationResult.locationsIndexedByNeuronId);
-    FileUtil::writeNeuronInfosToCSV("neuronInfos.csv", simulationResult.neuronInfos);
+    if (argc > 1 && std::string(argv[1]) == "--csv") {
+        PLOG_INFO << "Writing spike trains to csv";
+        FileUtil::writeSpikeTrainsToCSV("spikeTrains.csv", simulationResult.recordedSpikes);
+        FileUtil::writeSynapseInfosToCSV("synapseInfos.csv", simulationResult.finalSynapseInfos);
+        FileUtil::writeLocationsToCSV("locations.csv", simulationResult.locationsIndexedByNeuronId);
+        FileUtil::writeNeuronInfosToCSV("neuronInfos.csv", simulationResult.neuronInfos);
+        FileUtil::writeEventLoadToCSV("eventLoad.csv", simulationResult.eventLoadStats);
+        FileUtil::writeEventLoadHistogramsToCSV("eventLoadHistograms.csv", simulationResult.eventLoadStats);
+    } else {
+        PLOG_INFO << "Writing simulation result to simulationResult/";
+        ColumnarExport::writeSimulationResult("simulationResult", simulationResult);
+    }
 
     PLOG_INFO << "Terminating";
 
@@ -0,0 +1,105 @@
+#include <plog/Formatters/TxtFormatter.h>
+#include <plog/Appenders/ConsoleAppender.h>
+#include <plog/Init.h>
+#include <plog/Log.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <util/FileUtil.hpp>
+#include <experiments/POCDynamicSimulation.hpp>
+
+using namespace plog;
+using namespace soft_npu;
+
+struct DetectionAccuracy {
+    double partCorrect = 0;
+    double partWrong = 0;
+};
+
+// the weights of a plastic run of the detection task with the given seed
+std::vector<SynapseInfo> train(const ParamsType& templateParams, int seed) {
+    auto params = std::make_shared<ParamsType>(templateParams);
+    (*params)["simulation"]["seed"] = seed;
+
+    POCDynamicSimulation simulation(params);
+    auto simulationResult = simulation.run();
+
+    PLOG_INFO << "Seed " << seed << " trained: correct: " << 100.0 * simulation.optimResultHolder.partCorrect
+        << " %, wrong: " << 100.0 * simulation.optimResultHolder.partWrong << " %";
+
+    return simulationResult.finalSynapseInfos;
+}
+
+// the detection task with frozen trained weights, on the double engine unless an engine params section is given
+DetectionAccuracy infer(
+        const ParamsType& templateParams,
+        int seed,
+        const std::vector<SynapseInfo>& trainedSynapseInfos,
+        const ParamsType& engineParams) {
+
+    auto params = std::make_shared<ParamsType>(templateParams);
+    (*params)["simulation"]["seed"] = seed;
+    (*params)["simulation"]["inferenceMode"] = true;
+    (*params)["pocDynamicSimulation"]["rewardDosage"] = 0;
+
+    if (!engineParams.is_null()) {
+        params->update(engineParams);
+    }
+
+    POCDynamicSimulation simulation(params);
+    simulation.loadTrainedWeights(trainedSynapseInfos);
+    simulation.run();
+
+    return {simulation.optimResultHolder.partCorrect, simulation.optimResultHolder.partWrong};
+}
+
+int main()
+{
+    ConsoleAppender<plog::TxtFormatter> consoleAppender;
+
+    plog::init(plog::info, &consoleAppender);
+
+    PLOG_INFO << "Quantization drift evaluation starting";
+
+    auto templateParams = ParamsType::parse(FileUtil::getFileContent("../resources/paramsTemplate.json"));
+    templateParams["pocDynamicSimulation"]["abortAfterWallSeconds"] = std::numeric_limits<double>::max();
+
+    int numSeeds = 5;
+    std::vector<std::pair<std::string, ParamsType>> enginesToEvaluate = {
+        {"Quantized, 16 bit weights", {{"quantizedInference", {{"weightBits", 16}}}}},
+        {"Quantized, 8 bit weights", {{"quantizedInference", {{"weightBits", 8}}}}},
+        {"Clock-driven from 1 event per neuron", {{"clockDrivenInference", {{"minEventDensity", 1}}}}},
+        {"Clock-driven in all cycles", {{"clockDrivenInference", {{"minEventDensity", 0}}}}}
+    };
+
+    DetectionAccuracy reference;
+    std::vector<DetectionAccuracy> accuracies(enginesToEvaluate.size());
+
+    for (int seed = 0; seed < numSeeds; ++seed) {
+        auto trainedSynapseInfos = train(templateParams, seed);
+
+        auto seedReference = infer(templateParams, seed, trainedSynapseInfos, nullptr);
+        reference.partCorrect += seedReference.partCorrect / numSeeds;
+        reference.partWrong += seedReference.partWrong / numSeeds;
+
+        for (SizeType i = 0; i < enginesToEvaluate.size(); ++i) {
+            auto accuracy = infer(templateParams, seed, trainedSynapseInfos, enginesToEvaluate[i].second);
+            accuracies[i].partCorrect += accuracy.partCorrect / numSeeds;
+            accuracies[i].partWrong += accuracy.partWrong / numSeeds;
+        }
+    }
+
+    PLOG_INFO << "Double engine: correct: " << 100.0 * reference.partCorrect
+        << " %, wrong: " << 100.0 * reference.partWrong << " %";
+
+    for (SizeType i = 0; i < enginesToEvaluate.size(); ++i) {
+        const auto& accuracy = accuracies[i];
+
+        PLOG_INFO << enginesToEvaluate[i].first << ": correct: " << 100.0 * accuracy.partCorrect
+            << " %, wrong: " << 100.0 * accuracy.partWrong
+            << " %, drift: " << 100.0 * (accuracy.partCorrect - reference.partCorrect)
+            << " / " << 100.0 * (accuracy.partWrong - reference.partWrong) << " percentage points";
+    }
+
+    PLOG_INFO << "Terminating";
+}
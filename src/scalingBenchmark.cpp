@@ -0,0 +1,182 @@
+#include <plog/Formatters/TxtFormatter.h>
+#include <plog/Appenders/ConsoleAppender.h>
+#include <plog/Init.h>
+#include <plog/Log.h>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <util/FileUtil.hpp>
+#include <core/CycleController.hpp>
+#include <core/StaticInputSimulation.hpp>
+
+using namespace plog;
+using namespace soft_npu;
+
+// records the peak resident memory and network size before the simulation result is extracted
+class ScalingSimulation : public StaticInputSimulation {
+public:
+    using StaticInputSimulation::StaticInputSimulation;
+
+    void runController(
+            CycleController& controller,
+            Population& population,
+            TimeType simulationTime,
+            SynapticTransmissionStats& synapticTransmissionStats) override {
+        StaticInputSimulation::runController(controller, population, simulationTime, synapticTransmissionStats);
+
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        peakResidentBytes = static_cast<SizeType>(usage.ru_maxrss) * 1024;
+
+        numSynapses = 0;
+        for (auto it = population.cbeginNeurons(); it != population.cendNeurons(); ++it) {
+            numSynapses += std::distance((*it)->cbeginOutboundSynapses(), (*it)->cendOutboundSynapses());
+        }
+    }
+
+    SizeType peakResidentBytes = 0;
+    SizeType numSynapses = 0;
+};
+
+ParamsType makePointParams(
+        const ParamsType& templateParams,
+        SizeType numNeurons,
+        SizeType numTargetsExc,
+        ValueType noiseRate) {
+    auto params = templateParams;
+    auto& generatorParams = params["populationGenerators"]["r2dSheet"];
+
+    // the sheet is the unit square, so projection radii shrink with its size to keep the neighbourhoods equally populated
+    auto radiusScale = std::sqrt(generatorParams["numNeurons"].get<ValueType>() / numNeurons);
+    for (const auto& radiusName : {"radiusExcShort", "radiusExcLong", "radiusInh"}) {
+        generatorParams[radiusName] = generatorParams[radiusName].get<ValueType>() * radiusScale;
+    }
+
+    generatorParams["numNeurons"] = numNeurons;
+    generatorParams["numTargetsExc"] = numTargetsExc;
+    params["nonCoherentStimulator"]["rate"] = noiseRate;
+
+    return params;
+}
+
+nlohmann::json runPoint(const ParamsType& params) {
+    ScalingSimulation simulation(std::make_shared<const ParamsType>(params));
+    auto result = simulation.run();
+
+    nlohmann::json point;
+    point["numSynapses"] = simulation.numSynapses;
+    point["setupTime"] = result.wallTimeTotal - result.wallTimeEventProcessor;
+    point["wallTimeEventProcessor"] = result.wallTimeEventProcessor;
+    point["numEventsProcessed"] = result.numEventsProcessed;
+    point["eventsPerSecond"] = result.eventThroughput;
+    point["spikesPerSecond"] = result.spikeProcessingThroughput;
+    point["meanExcitatoryFiringRate"] = result.meanExcitatoryFiringRate;
+    point["meanInhibitoryFiringRate"] = result.meanInhibitoryFiringRate;
+    point["peakResidentBytes"] = simulation.peakResidentBytes;
+    return point;
+}
+
+// each point runs in its own process, so that its peak resident memory is not masked by earlier, larger points
+nlohmann::json runPointInChildProcess(const ParamsType& params) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        throw std::runtime_error("Unable to create pipe");
+    }
+
+    auto pid = fork();
+    if (pid < 0) {
+        throw std::runtime_error("Unable to fork");
+    }
+
+    if (pid == 0) {
+        close(fds[0]);
+        int exitCode = 0;
+
+        try {
+            auto pointJson = runPoint(params).dump();
+            for (size_t offset = 0; offset < pointJson.size(); ) {
+                auto numWritten = write(fds[1], pointJson.data() + offset, pointJson.size() - offset);
+                if (numWritten <= 0) {
+                    exitCode = 1;
+                    break;
+                }
+                offset += numWritten;
+            }
+        } catch (const std::exception& e) {
+            PLOG_ERROR << e.what();
+            exitCode = 1;
+        }
+
+        close(fds[1]);
+        _exit(exitCode);
+    }
+
+    close(fds[1]);
+
+    std::string pointJson;
+    char buffer[4096];
+    ssize_t numRead;
+    while ((numRead = read(fds[0], buffer, sizeof(buffer))) > 0) {
+        pointJson.append(buffer, numRead);
+    }
+    close(fds[0]);
+
+    int status;
+    waitpid(pid, &status, 0);
+
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || pointJson.empty()) {
+        nlohmann::json failedPoint;
+        failedPoint["error"] = WIFSIGNALED(status) ?
+                "terminated by signal " + std::to_string(WTERMSIG(status)) : std::string("failed");
+        return failedPoint;
+    }
+
+    return nlohmann::json::parse(pointJson);
+}
+
+int main(int argc, char * argv[])
+{
+    ConsoleAppender<plog::TxtFormatter> consoleAppender;
+
+    plog::init(plog::info, &consoleAppender);
+
+    PLOG_INFO << "Scaling benchmark starting";
+
+    std::string paramsPath = argc > 1 ? argv[1] : "../resources/scalingBenchmarkParams.json";
+    std::string outputPath = argc > 2 ? argv[2] : "scalingBenchmark.json";
+
+    auto templateParams = ParamsType::parse(FileUtil::getFileContent(paramsPath));
+    const auto& sweepParams = templateParams["scalingBenchmark"];
+
+    nlohmann::json points = nlohmann::json::array();
+
+    for (SizeType numNeurons : sweepParams["numNeurons"]) {
+        for (SizeType numTargetsExc : sweepParams["numTargetsExc"]) {
+            for (ValueType noiseRate : sweepParams["noiseRates"]) {
+                PLOG_INFO << "Running " << numNeurons << " neurons, " << numTargetsExc
+                    << " excitatory targets, noise rate " << noiseRate;
+
+                auto point = runPointInChildProcess(makePointParams(templateParams, numNeurons, numTargetsExc, noiseRate));
+                point["numNeurons"] = numNeurons;
+                point["numTargetsExc"] = numTargetsExc;
+                point["noiseRate"] = noiseRate;
+
+                PLOG_INFO << point.dump();
+                points.push_back(point);
+            }
+        }
+    }
+
+    nlohmann::json output;
+    output["simulationTime"] = templateParams["simulation"]["untilTime"];
+    output["points"] = points;
+
+    std::ofstream os(outputPath);
+    os << output.dump(2) << std::endl;
+
+    PLOG_INFO << "Results written to " << outputPath;
+    PLOG_INFO << "Terminating";
+}
@@ -0,0 +1,112 @@
+#include "BenchmarkComparison.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace soft_npu::BenchmarkComparison {
+
+// scales the MAD to a standard deviation estimate for normally distributed samples
+static constexpr double madToStandardDeviation = 1.4826;
+
+double median(std::vector<double> samples) {
+    if (samples.empty()) {
+        throw std::runtime_error("Median of empty sample");
+    }
+
+    auto middle = samples.begin() + samples.size() / 2;
+    std::nth_element(samples.begin(), middle, samples.end());
+
+    if (samples.size() % 2 == 1) {
+        return *middle;
+    }
+
+    return (*middle + *std::max_element(samples.begin(), middle)) / 2;
+}
+
+double medianAbsoluteDeviation(const std::vector<double>& samples) {
+    auto sampleMedian = median(samples);
+    std::vector<double> absoluteDeviations;
+
+    std::transform(samples.cbegin(), samples.cend(), std::back_inserter(absoluteDeviations), [sampleMedian](double sample) {
+        return std::abs(sample - sampleMedian);
+    });
+
+    return median(std::move(absoluteDeviations));
+}
+
+static void validateMetrics(const ParamsType& result, const std::string& resultName) {
+    if (!result.is_object()) {
+        throw std::runtime_error("Metrics of the " + resultName + " result are not an object");
+    }
+
+    for (auto it = result.begin(); it != result.end(); ++it) {
+        const auto& metric = *it;
+        auto samplesIt = metric.find("samples");
+        auto higherIsBetterIt = metric.find("higherIsBetter");
+
+        if (!metric.is_object() ||
+                higherIsBetterIt == metric.end() || !higherIsBetterIt->is_boolean() ||
+                samplesIt == metric.end() || !samplesIt->is_array() || samplesIt->empty() ||
+                !std::all_of(samplesIt->begin(), samplesIt->end(), [](const ParamsType& sample) {
+                    return sample.is_number();
+                })) {
+            throw std::runtime_error("Invalid metric " + it.key() + " in the " + resultName + " result");
+        }
+    }
+}
+
+std::vector<MetricComparison> compare(
+        const ParamsType& baselineResult,
+        const ParamsType& currentResult,
+        double regressionThreshold,
+        double madMultiplier) {
+    validateMetrics(baselineResult, "baseline");
+    validateMetrics(currentResult, "current");
+
+    std::vector<MetricComparison> comparisons;
+
+    for (auto it = baselineResult.begin(); it != baselineResult.end(); ++it) {
+        if (currentResult.find(it.key()) == currentResult.end()) {
+            comparisons.push_back({it.key(), 0, 0, 0, 0, false, true});
+        }
+    }
+
+    for (auto it = currentResult.begin(); it != currentResult.end(); ++it) {
+        auto baselineIt = baselineResult.find(it.key());
+        if (baselineIt == baselineResult.end()) {
+            continue;
+        }
+
+        std::vector<double> baselineSamples = (*baselineIt)["samples"];
+        std::vector<double> currentSamples = (*it)["samples"];
+        bool higherIsBetter = (*it)["higherIsBetter"];
+
+        auto baselineMedian = median(baselineSamples);
+        auto currentMedian = median(currentSamples);
+
+        if (baselineMedian == 0) {
+            continue;
+        }
+
+        auto relativeChange = (currentMedian - baselineMedian) / baselineMedian;
+        auto relativeRegression = higherIsBetter ? -relativeChange : relativeChange;
+
+        auto relativeNoise = madMultiplier * madToStandardDeviation * std::max(
+                medianAbsoluteDeviation(baselineSamples),
+                medianAbsoluteDeviation(currentSamples)) / std::abs(baselineMedian);
+
+        comparisons.push_back({
+                it.key(),
+                baselineMedian,
+                currentMedian,
+                relativeRegression,
+                relativeNoise,
+                relativeRegression > regressionThreshold && relativeRegression > relativeNoise,
+                false});
+    }
+
+    return comparisons;
+}
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <string>
+#include <vector>
+
+namespace soft_npu {
+
+struct MetricComparison {
+    std::string metricName;
+    double baselineMedian;
+    double currentMedian;
+    // relative change in the direction of a regression, e.g. 0.1 for 10% lower throughput or 10% longer phase time
+    double relativeRegression;
+    // run-to-run noise of both results, relative to the baseline median
+    double relativeNoise;
+    bool isRegression;
+    // the metric is in the baseline but not in the current result, so it could not be checked; the medians and
+    // relative values are then unset
+    bool isMissing;
+};
+
+namespace BenchmarkComparison {
+
+double median(std::vector<double> samples);
+
+// median absolute deviation from the median
+double medianAbsoluteDeviation(const std::vector<double>& samples);
+
+// Both results map metric names to {"higherIsBetter": bool, "samples": [...]}. A metric regresses when its median
+// worsens by more than the threshold and by more than madMultiplier robust standard deviations (1.4826 MAD) of the
+// noisier result. Metrics missing from the baseline are skipped, metrics missing from the current result are reported
+// as missing. Throws if either result does not have this layout.
+std::vector<MetricComparison> compare(
+        const ParamsType& baselineResult,
+        const ParamsType& currentResult,
+        double regressionThreshold,
+        double madMultiplier = 3.0);
+
+}
+
+}
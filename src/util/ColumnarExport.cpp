@@ -0,0 +1,205 @@
+#include "ColumnarExport.hpp"
+#include "ColumnarTable.hpp"
+#include <cstdint>
+#include <filesystem>
+
+namespace soft_npu::ColumnarExport {
+
+static void writeSummary(const std::string& filePath, const SimulationResult& simulationResult) {
+    ColumnarTable table(0);
+    table.setAttribute("simulationTime", simulationResult.simulationTime);
+    table.setAttribute("numExcitatorySpikes", simulationResult.numExcitatorySpikes);
+    table.setAttribute("numInhibitorySpikes", simulationResult.numInhibitorySpikes);
+    table.setAttribute("meanExcitatoryFiringRate", simulationResult.meanExcitatoryFiringRate);
+    table.setAttribute("meanInhibitoryFiringRate", simulationResult.meanInhibitoryFiringRate);
+    table.setAttribute("wallTimeTotal", simulationResult.wallTimeTotal);
+    table.setAttribute("wallTimeEventProcessor", simulationResult.wallTimeEventProcessor);
+    table.setAttribute("numEventsProcessed", simulationResult.numEventsProcessed);
+    table.setAttribute("eventThroughput", simulationResult.eventThroughput);
+    table.setAttribute("spikeProcessingThroughput", simulationResult.spikeProcessingThroughput);
+    table.setAttribute("synapticTransmissionProcessingThroughput",
+            simulationResult.synapticTransmissionProcessingThroughput);
+    table.write(filePath);
+}
+
+static void writeSpikes(const std::string& filePath, const std::vector<NeuronSpikeInfo>& spikeInfos) {
+    ColumnarTable table(spikeInfos.size());
+    table.addExtractedColumn("time", spikeInfos, [](const auto& spikeInfo) { return spikeInfo.time; });
+    table.addExtractedColumn("neuronId", spikeInfos, [](const auto& spikeInfo) {
+        return static_cast<uint64_t>(spikeInfo.neuronId);
+    });
+    table.write(filePath);
+}
+
+static void writeNeurons(const std::string& filePath, const SimulationResult& simulationResult) {
+    const auto& neuronInfos = simulationResult.neuronInfos;
+    const auto& locations = simulationResult.locationsIndexedByNeuronId;
+
+    ColumnarTable table(neuronInfos.size());
+    table.addExtractedColumn("neuronId", neuronInfos, [](const auto& neuronInfo) {
+        return static_cast<uint64_t>(neuronInfo.neuronId);
+    });
+    table.addExtractedColumn("isInhibitory", neuronInfos, [](const auto& neuronInfo) {
+        return neuronInfo.isInhibitory;
+    });
+    table.addExtractedColumn("locationX", locations, [](const auto& location) { return location[0]; });
+    table.addExtractedColumn("locationY", locations, [](const auto& location) { return location[1]; });
+    table.write(filePath);
+}
+
+static void writeSynapses(const std::string& filePath, const std::vector<SynapseInfo>& synapseInfos) {
+    ColumnarTable table(synapseInfos.size());
+    table.addExtractedColumn("preSynapticNeuronId", synapseInfos, [](const auto& synapseInfo) {
+        return static_cast<uint64_t>(synapseInfo.preSynapticNeuronId);
+    });
+    table.addExtractedColumn("postSynapticNeuronId", synapseInfos, [](const auto& synapseInfo) {
+        return static_cast<uint64_t>(synapseInfo.postSynapticNeuronId);
+    });
+    table.addExtractedColumn("weight", synapseInfos, [](const auto& synapseInfo) { return synapseInfo.weight; });
+    table.addExtractedColumn("isInhibitory", synapseInfos, [](const auto& synapseInfo) {
+        return synapseInfo.isInhibitory;
+    });
+    table.write(filePath);
+}
+
+static void writeVoltageRecordings(const std::string& filePath, const std::vector<VoltageRecording>& voltageRecordings) {
+    ColumnarTable table(voltageRecordings.size());
+    table.addExtractedColumn("neuronId", voltageRecordings, [](const auto& voltageRecording) {
+        return static_cast<uint64_t>(voltageRecording.neuronId);
+    });
+    table.addExtractedColumn("time", voltageRecordings, [](const auto& voltageRecording) {
+        return voltageRecording.time;
+    });
+    table.addExtractedColumn("voltage", voltageRecordings, [](const auto& voltageRecording) {
+        return voltageRecording.voltage;
+    });
+    table.write(filePath);
+}
+
+static void writeVoltageSamples(const std::string& filePath, const VoltageSamples& voltageSamples) {
+    ColumnarTable table(voltageSamples.times.size());
+    table.setAttribute("neuronIds", voltageSamples.neuronIds);
+    table.addColumn("time", voltageSamples.times);
+    table.addColumn("voltage", voltageSamples.voltages, voltageSamples.neuronIds.size());
+    table.write(filePath);
+}
+
+static void writePhaseWallTimes(const std::string& filePath, const std::vector<PhaseWallTime>& phaseWallTimes) {
+    ColumnarTable table(phaseWallTimes.size());
+
+    ParamsType phaseNames = ParamsType::array();
+    for (const auto& phaseWallTime : phaseWallTimes) {
+        phaseNames.push_back(phaseWallTime.phaseName);
+    }
+
+    table.setAttribute("phaseNames", std::move(phaseNames));
+    table.addExtractedColumn("wallTime", phaseWallTimes, [](const auto& phaseWallTime) {
+        return phaseWallTime.wallTime;
+    });
+    table.write(filePath);
+}
+
+static void writePhasePerfCounts(const std::string& filePath, const std::vector<PhasePerfCounts>& phasePerfCounts) {
+    ColumnarTable table(phasePerfCounts.size());
+
+    ParamsType phaseNames = ParamsType::array();
+    for (const auto& phase : phasePerfCounts) {
+        phaseNames.push_back(phase.phaseName);
+    }
+
+    table.setAttribute("phaseNames", std::move(phaseNames));
+    table.addExtractedColumn("cycles", phasePerfCounts, [](const auto& phase) { return phase.counts.cycles; });
+    table.addExtractedColumn("instructions", phasePerfCounts, [](const auto& phase) {
+        return phase.counts.instructions;
+    });
+    table.addExtractedColumn("l1dReadMisses", phasePerfCounts, [](const auto& phase) {
+        return phase.counts.l1dReadMisses;
+    });
+    table.addExtractedColumn("llcReadMisses", phasePerfCounts, [](const auto& phase) {
+        return phase.counts.llcReadMisses;
+    });
+    table.addExtractedColumn("branchMisses", phasePerfCounts, [](const auto& phase) {
+        return phase.counts.branchMisses;
+    });
+    table.addExtractedColumn("timeEnabled", phasePerfCounts, [](const auto& phase) {
+        return phase.counts.timeEnabled;
+    });
+    table.addExtractedColumn("timeRunning", phasePerfCounts, [](const auto& phase) {
+        return phase.counts.timeRunning;
+    });
+    table.write(filePath);
+}
+
+static void writeEventLoad(const std::string& filePath, const EventLoadStats& eventLoadStats) {
+    const auto& samples = eventLoadStats.getSamples();
+
+    ColumnarTable table(samples.size());
+
+    ParamsType queueNames = ParamsType::array();
+    std::vector<uint64_t> maxSizes;
+    maxSizes.reserve(samples.size() * static_cast<SizeType>(EventQueue::numQueues));
+
+    for (SizeType queue = 0; queue < static_cast<SizeType>(EventQueue::numQueues); ++queue) {
+        queueNames.push_back(toString(static_cast<EventQueue>(queue)));
+    }
+
+    for (const auto& sample : samples) {
+        maxSizes.insert(maxSizes.end(), sample.maxSizes.cbegin(), sample.maxSizes.cend());
+    }
+
+    table.setAttribute("queueNames", std::move(queueNames));
+    table.addExtractedColumn("time", samples, [](const auto& sample) { return sample.time; });
+    table.addColumn("maxSize", std::move(maxSizes), static_cast<SizeType>(EventQueue::numQueues));
+    table.write(filePath);
+}
+
+static void writeEventLoadHistograms(const std::string& filePath, const EventLoadStats& eventLoadStats) {
+    constexpr auto numQueues = static_cast<SizeType>(EventQueue::numQueues);
+
+    ParamsType queueNames = ParamsType::array();
+    ParamsType highWaterMarks = ParamsType::array();
+
+    for (SizeType queue = 0; queue < numQueues; ++queue) {
+        queueNames.push_back(toString(static_cast<EventQueue>(queue)));
+        highWaterMarks.push_back(eventLoadStats.getQueueLoadStats(static_cast<EventQueue>(queue)).getHighWaterMark());
+    }
+
+    // one row per histogram bucket with one entry per queue
+    std::vector<uint64_t> sizeLowerBounds;
+    std::vector<uint64_t> numCycles;
+
+    for (SizeType bucket = 0; bucket < QueueLoadStats::numBuckets; ++bucket) {
+        sizeLowerBounds.push_back(QueueLoadStats::getBucketLowerBound(bucket));
+
+        for (SizeType queue = 0; queue < numQueues; ++queue) {
+            numCycles.push_back(eventLoadStats.getQueueLoadStats(static_cast<EventQueue>(queue)).getHistogram()[bucket]);
+        }
+    }
+
+    ColumnarTable table(QueueLoadStats::numBuckets);
+    table.setAttribute("queueNames", std::move(queueNames));
+    table.setAttribute("highWaterMarks", std::move(highWaterMarks));
+    table.addColumn("sizeLowerBound", std::move(sizeLowerBounds));
+    table.addColumn("numCycles", std::move(numCycles), numQueues);
+    table.write(filePath);
+}
+
+void writeSimulationResult(const std::string& directoryPath, const SimulationResult& simulationResult) {
+    std::filesystem::create_directories(directoryPath);
+    auto getFilePath = [&directoryPath](const char* tableName) {
+        return (std::filesystem::path(directoryPath) / (std::string(tableName) + ".snpc")).string();
+    };
+
+    writeSummary(getFilePath("summary"), simulationResult);
+    writeSpikes(getFilePath("spikes"), simulationResult.recordedSpikes);
+    writeNeurons(getFilePath("neurons"), simulationResult);
+    writeSynapses(getFilePath("synapses"), simulationResult.finalSynapseInfos);
+    writeVoltageRecordings(getFilePath("voltageRecordings"), simulationResult.voltageRecordings);
+    writeVoltageSamples(getFilePath("voltageSamples"), simulationResult.voltageSamples);
+    writePhaseWallTimes(getFilePath("phaseWallTimes"), simulationResult.phaseWallTimes);
+    writePhasePerfCounts(getFilePath("phasePerfCounts"), simulationResult.phasePerfCounts);
+    writeEventLoad(getFilePath("eventLoad"), simulationResult.eventLoadStats);
+    writeEventLoadHistograms(getFilePath("eventLoadHistograms"), simulationResult.eventLoadStats);
+}
+
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <core/SimulationResult.hpp>
+#include <string>
+
+namespace soft_npu::ColumnarExport {
+
+// Writes every field of the result into the given directory (created if missing), one ColumnarTable file per table:
+// summary (scalars as attributes), spikes, neurons (with locations), synapses, voltageRecordings, voltageSamples,
+// phaseWallTimes, phasePerfCounts, eventLoad and eventLoadHistograms. scripts/soft_npu_columnar.py reads them.
+void writeSimulationResult(const std::string& directoryPath, const SimulationResult& simulationResult);
+
+}
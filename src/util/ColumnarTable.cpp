@@ -0,0 +1,87 @@
+#include "ColumnarTable.hpp"
+#include <fstream>
+#include <stdexcept>
+
+namespace soft_npu {
+
+static constexpr SizeType alignment = 64;
+
+static SizeType alignUp(SizeType offset) noexcept {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+ColumnarTable::ColumnarTable(SizeType numRows) noexcept : numRows(numRows), attributes(ParamsType::object()) {
+}
+
+void ColumnarTable::setAttribute(const std::string& name, ParamsType value) {
+    attributes[name] = std::move(value);
+}
+
+void ColumnarTable::write(const std::string& filePath) const {
+    constexpr SizeType prefixSize = 16;
+
+    ParamsType header;
+    header["numRows"] = numRows;
+    header["attributes"] = attributes;
+    header["columns"] = ParamsType::array();
+
+    // the column offsets depend on the header length and vice versa, so the header is rebuilt until its padded length
+    // is stable
+    std::string headerString;
+    SizeType dataOffset = 0;
+
+    for (SizeType headerSize = 0; ; ) {
+        dataOffset = alignUp(prefixSize + headerSize);
+        auto offset = dataOffset;
+
+        header["columns"] = ParamsType::array();
+
+        for (const auto& column : columns) {
+            ParamsType shape = column.width == 1 ? ParamsType{numRows} : ParamsType{numRows, column.width};
+            header["columns"].push_back({
+                {"name", column.name},
+                {"dtype", column.dtype},
+                {"shape", shape},
+                {"offset", offset}});
+            offset = alignUp(offset + column.numBytes);
+        }
+
+        headerString = header.dump();
+
+        if (alignUp(prefixSize + headerString.size()) == dataOffset) {
+            break;
+        }
+
+        headerSize = headerString.size();
+    }
+
+    headerString.resize(dataOffset - prefixSize, ' ');
+
+    std::ofstream os(filePath, std::ios::binary);
+    if (!os) {
+        throw std::runtime_error("Unable to open file: " + filePath);
+    }
+
+    uint64_t headerLength = headerString.size();
+    os.write("SNPCOLS1", 8);
+    os.write(reinterpret_cast<const char*>(&headerLength), sizeof(headerLength));
+    os.write(headerString.data(), headerString.size());
+
+    auto position = dataOffset;
+    const std::string padding(alignment, '\0');
+
+    for (const auto& column : columns) {
+        column.writeData(os);
+        position += column.numBytes;
+
+        auto alignedPosition = alignUp(position);
+        os.write(padding.data(), alignedPosition - position);
+        position = alignedPosition;
+    }
+
+    if (!os) {
+        throw std::runtime_error("Unable to write file: " + filePath);
+    }
+}
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace soft_npu {
+
+// Table of typed columns written as one binary file that numpy can map without parsing:
+//   char[8] "SNPCOLS1", uint64 header length, JSON header padded with spaces to a multiple of 64 bytes in total,
+//   then the data of each column, starting at a multiple of 64 bytes.
+// The header is {"numRows": n, "attributes": {...}, "columns": [{"name", "dtype", "shape", "offset"}, ...]}, where
+// dtype is a numpy type string such as "<f8" and shape is [n] or [n, width] for row-major matrix columns. A table
+// without rows carries its data in the attributes only. The header length and the data are in host byte order, which
+// the dtype strings record.
+class ColumnarTable {
+public:
+    explicit ColumnarTable(SizeType numRows) noexcept;
+
+    template<typename T>
+    void addColumn(const std::string& name, std::vector<T> values, SizeType width = 1) {
+        addColumn(name, getDtype<T>(), std::move(values), width);
+    }
+
+    // extracts one column from row structs, bool values are stored as numpy bools of one byte
+    template<typename Row, typename F>
+    void addExtractedColumn(const std::string& name, const std::vector<Row>& rows, F getValue) {
+        using Value = std::decay_t<decltype(getValue(rows.front()))>;
+        std::vector<std::conditional_t<std::is_same_v<Value, bool>, uint8_t, Value>> values;
+        values.reserve(rows.size());
+
+        for (const auto& row : rows) {
+            values.push_back(getValue(row));
+        }
+
+        addColumn(name, getDtype<Value>(), std::move(values), 1);
+    }
+
+    void setAttribute(const std::string& name, ParamsType value);
+
+    void write(const std::string& filePath) const;
+
+private:
+    struct Column {
+        std::string name;
+        std::string dtype;
+        SizeType width;
+        SizeType numBytes;
+        std::function<void(std::ostream&)> writeData;
+    };
+
+    template<typename T>
+    void addColumn(const std::string& name, std::string dtype, std::vector<T> values, SizeType width) {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "Columns must hold arithmetic values");
+
+        if (values.size() != numRows * width) {
+            throw std::runtime_error("Column " + name + " does not match the number of rows");
+        }
+
+        auto sharedValues = std::make_shared<std::vector<T>>(std::move(values));
+        auto numBytes = sharedValues->size() * sizeof(T);
+
+        columns.push_back({name, std::move(dtype), width, numBytes, [sharedValues, numBytes](std::ostream& os) {
+            os.write(reinterpret_cast<const char*>(sharedValues->data()), numBytes);
+        }});
+    }
+
+    template<typename T>
+    static std::string getDtype() {
+        // bool is stored as one byte
+        char kind = std::is_same_v<T, bool> ? 'b' : std::is_floating_point_v<T> ? 'f' : std::is_signed_v<T> ? 'i' : 'u';
+        char byteOrder = sizeof(T) == 1 ? '|' : __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ? '<' : '>';
+        return {byteOrder, kind, static_cast<char>('0' + sizeof(T))};
+    }
+
+    SizeType numRows;
+    ParamsType attributes;
+    std::vector<Column> columns;
+};
+
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace soft_npu {
+
+// Philox4x32-10 counter-based engine. A stream is addressed by (seed, subsystem, entity, step), so draws
+// do not depend on the order in which streams are consumed, which makes them safe to use from parallel code.
+class CounterBasedRandomEngine {
+public:
+
+    using result_type = uint32_t;
+    using BlockType = std::array<uint32_t, 4>;
+    using KeyType = std::array<uint32_t, 2>;
+
+    enum class Subsystem : uint32_t {
+        populationGeneration = 1,
+        nonCoherentStimulation = 2
+    };
+
+    CounterBasedRandomEngine(
+            uint64_t seed,
+            Subsystem subsystem,
+            uint32_t entity,
+            uint32_t step) noexcept :
+            key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32u)},
+            counter{0, step, entity, static_cast<uint32_t>(subsystem)},
+            output{},
+            outputIndex(output.size()) {
+    }
+
+    static constexpr result_type min() noexcept {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    static constexpr result_type max() noexcept {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() noexcept {
+        if (outputIndex == output.size()) {
+            output = generateBlock(counter, key);
+            ++ counter[0];
+            outputIndex = 0;
+        }
+
+        return output[outputIndex++];
+    }
+
+    void discard(unsigned long long numDraws) noexcept {
+        for (; numDraws > 0; --numDraws) {
+            (*this)();
+        }
+    }
+
+    static BlockType generateBlock(BlockType counter, KeyType key) noexcept {
+        for (int round = 0; round < 10; ++round) {
+            uint64_t product0 = static_cast<uint64_t>(multiplier0) * counter[0];
+            uint64_t product1 = static_cast<uint64_t>(multiplier1) * counter[2];
+
+            counter = {
+                    static_cast<uint32_t>(product1 >> 32u) ^ counter[1] ^ key[0],
+                    static_cast<uint32_t>(product1),
+                    static_cast<uint32_t>(product0 >> 32u) ^ counter[3] ^ key[1],
+                    static_cast<uint32_t>(product0)
+            };
+
+            key[0] += weyl0;
+            key[1] += weyl1;
+        }
+
+        return counter;
+    }
+
+private:
+    static constexpr uint32_t multiplier0 = 0xD2511F53;
+    static constexpr uint32_t multiplier1 = 0xCD9E8D57;
+    static constexpr uint32_t weyl0 = 0x9E3779B9;
+    static constexpr uint32_t weyl1 = 0xBB67AE85;
+
+    KeyType key;
+    BlockType counter;
+    BlockType output;
+    std::size_t outputIndex;
+};
+
+}
@@ -8,6 +8,7 @@
 #include <core/SynapseInfo.hpp>
 #include <neuro/Population.hpp>
 #include <core/NeuronInfo.hpp>
+#include <core/EventLoadStats.hpp>
 #include <iomanip>
 
 namespace soft_npu::FileUtil {
@@ -56,6 +57,36 @@ void writeNeuronInfosToCSV(const std::string& filePath, const std::vector<Neuron
     fs.close();
 }
 
+void writeEventLoadToCSV(const std::string& filePath, const EventLoadStats& eventLoadStats) {
+    std::ofstream fs;
+    fs.open(filePath);
+    fs << "Time,TransmissionEventsPerSlot,ThresholdEvalCandidates,CommonEvents,EligibilityTraces" << std::endl;
+    for (const auto& sample : eventLoadStats.getSamples()) {
+        fs << sample.time;
+        for (auto maxSize : sample.maxSizes) {
+            fs << ',' << maxSize;
+        }
+        fs << std::endl;
+    }
+    fs.close();
+}
+
+void writeEventLoadHistogramsToCSV(const std::string& filePath, const EventLoadStats& eventLoadStats) {
+    std::ofstream fs;
+    fs.open(filePath);
+    fs << "Queue,SizeLowerBound,NumCycles" << std::endl;
+    for (SizeType queue = 0; queue < static_cast<SizeType>(EventQueue::numQueues); ++queue) {
+        const auto& histogram = eventLoadStats.getQueueLoadStats(static_cast<EventQueue>(queue)).getHistogram();
+        for (SizeType bucket = 0; bucket < histogram.size(); ++bucket) {
+            if (histogram[bucket] > 0) {
+                fs << toString(static_cast<EventQueue>(queue)) << ',' << QueueLoadStats::getBucketLowerBound(bucket)
+                    << ',' << histogram[bucket] << std::endl;
+            }
+        }
+    }
+    fs.close();
+}
+
 template<typename T>
 std::string getFileContent(const T& path) {
     std::ifstream is(path);
@@ -0,0 +1,114 @@
+#include "NumaTopology.hpp"
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <fstream>
+#include <sstream>
+#include <sched.h>
+
+namespace soft_npu::NumaTopology {
+
+static std::vector<int> getAllowedCpuIds() {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    std::vector<int> cpuIds;
+
+    if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+        throw std::runtime_error("Could not read CPU affinity");
+    }
+
+    for (int cpuId = 0; cpuId < CPU_SETSIZE; ++cpuId) {
+        if (CPU_ISSET(cpuId, &cpuSet)) {
+            cpuIds.push_back(cpuId);
+        }
+    }
+
+    return cpuIds;
+}
+
+std::vector<int> parseCpuList(const std::string& cpuList) {
+    std::vector<int> cpuIds;
+    std::stringstream ss(cpuList);
+    std::string range;
+
+    while (std::getline(ss, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+
+        auto separatorPos = range.find('-');
+        auto first = std::stoi(range.substr(0, separatorPos));
+        auto last = separatorPos == std::string::npos ? first : std::stoi(range.substr(separatorPos + 1));
+
+        for (auto cpuId = first; cpuId <= last; ++cpuId) {
+            cpuIds.push_back(cpuId);
+        }
+    }
+
+    return cpuIds;
+}
+
+std::vector<NumaNode> readNumaNodes() {
+    auto allowedCpuIds = getAllowedCpuIds();
+    std::vector<NumaNode> numaNodes;
+
+    std::ifstream onlineNodesStream("/sys/devices/system/node/online");
+    std::string onlineNodes;
+    std::getline(onlineNodesStream, onlineNodes);
+
+    for (auto nodeId : parseCpuList(onlineNodes)) {
+        std::ifstream cpuListStream("/sys/devices/system/node/node" + std::to_string(nodeId) + "/cpulist");
+        std::string cpuList;
+        std::getline(cpuListStream, cpuList);
+
+        NumaNode numaNode{static_cast<SizeType>(nodeId), {}};
+
+        for (auto cpuId : parseCpuList(cpuList)) {
+            if (std::find(allowedCpuIds.cbegin(), allowedCpuIds.cend(), cpuId) != allowedCpuIds.cend()) {
+                numaNode.cpuIds.push_back(cpuId);
+            }
+        }
+
+        if (!numaNode.cpuIds.empty()) {
+            numaNodes.push_back(std::move(numaNode));
+        }
+    }
+
+    if (numaNodes.empty()) {
+        numaNodes.push_back({0, allowedCpuIds});
+    }
+
+    return numaNodes;
+}
+
+std::map<SizeType, SizeType> getResidentBytesByNode() {
+    std::map<SizeType, SizeType> residentBytesByNode;
+    std::ifstream numaMapsStream("/proc/self/numa_maps");
+    std::string line;
+
+    while (std::getline(numaMapsStream, line)) {
+        std::stringstream ss(line);
+        std::string token;
+        std::vector<std::pair<SizeType, SizeType>> numPagesByNode;
+        SizeType pageSize = 4096;
+
+        while (ss >> token) {
+            auto separatorPos = token.find('=');
+
+            if (token.size() > 1 && token[0] == 'N' && std::isdigit(token[1]) && separatorPos != std::string::npos) {
+                numPagesByNode.emplace_back(
+                        std::stoul(token.substr(1, separatorPos - 1)), std::stoul(token.substr(separatorPos + 1)));
+            } else if (token.rfind("kernelpagesize_kB=", 0) == 0) {
+                pageSize = std::stoul(token.substr(separatorPos + 1)) * 1024;
+            }
+        }
+
+        for (const auto& [nodeId, numPages] : numPagesByNode) {
+            residentBytesByNode[nodeId] += numPages * pageSize;
+        }
+    }
+
+    return residentBytesByNode;
+}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace soft_npu {
+
+struct NumaNode {
+    SizeType nodeId;
+    std::vector<int> cpuIds;
+};
+
+namespace NumaTopology {
+
+// parses a kernel CPU list such as "0-3,8,10-11"
+std::vector<int> parseCpuList(const std::string& cpuList);
+
+// nodes with at least one CPU this process may run on; a single node with all allowed CPUs if the topology is unknown
+std::vector<NumaNode> readNumaNodes();
+
+// resident memory of this process per node, from /proc/self/numa_maps; empty if unavailable
+std::map<SizeType, SizeType> getResidentBytesByNode();
+
+}
+
+}
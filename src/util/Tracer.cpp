@@ -0,0 +1,251 @@
+#include "Tracer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace soft_npu::Tracer {
+
+namespace {
+
+// Kept for the lifetime of the process, so that a thread can raise its recording flag without first checking that its
+// buffer is still alive. A thread joins a trace with its first event in that trace.
+struct ThreadBuffer {
+    // raised while the thread is between checking enabled and writing to events
+    std::atomic<bool> isRecording{false};
+    // the buffer created before this one, for walking all buffers without the mutex
+    ThreadBuffer* next = nullptr;
+    uint64_t generation = 0;
+    SizeType threadIndex = 0;
+    std::vector<TraceEvent> events;
+    SizeType numDroppedEvents = 0;
+};
+
+std::mutex mutex;
+// owned here rather than by the threads, so that the events of exited threads are kept
+std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+std::atomic<ThreadBuffer*> lastThreadBuffer(nullptr);
+// the buffers of the threads that joined the current or last trace, in order of joining
+std::vector<ThreadBuffer*> traceThreadBuffers;
+std::atomic<bool> isClaimed(false);
+std::atomic<bool> enabled(false);
+std::atomic<uint64_t> generation(0);
+std::atomic<SizeType> cycleSampleInterval(0);
+SizeType maxNumEventsPerThread = 0;
+std::atomic<std::chrono::steady_clock::rep> startTicks(0);
+
+thread_local ThreadBuffer* threadBuffer = nullptr;
+
+ThreadBuffer& getThreadBuffer() {
+    if (threadBuffer == nullptr) {
+        std::lock_guard<std::mutex> lock(mutex);
+        threadBuffers.push_back(std::make_unique<ThreadBuffer>());
+        threadBuffer = threadBuffers.back().get();
+        threadBuffer->next = lastThreadBuffer.load();
+        lastThreadBuffer.store(threadBuffer);
+    }
+
+    return *threadBuffer;
+}
+
+// once per thread and trace, while recording is enabled
+void joinTrace(ThreadBuffer& buffer, uint64_t currentGeneration) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    buffer.generation = currentGeneration;
+    buffer.threadIndex = traceThreadBuffers.size();
+    buffer.events.clear();
+    buffer.events.reserve(std::min(maxNumEventsPerThread, static_cast<SizeType>(4096)));
+    buffer.numDroppedEvents = 0;
+
+    traceThreadBuffers.push_back(&buffer);
+}
+
+void disable() noexcept {
+    enabled.store(false);
+
+    // A buffer added after this load raises its flag after the store above, so its thread sees enabled false. For the
+    // others, either the thread sees enabled false or its raised flag is seen here.
+    for (auto buffer = lastThreadBuffer.load(); buffer != nullptr; buffer = buffer->next) {
+        while (buffer->isRecording.load()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void writeChromeTrace(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::ofstream os(path);
+    if (!os) {
+        throw std::runtime_error("Unable to open file: " + path);
+    }
+
+    SizeType numDroppedEvents = 0;
+    const char* separator = "";
+
+    os << "{\"traceEvents\":[";
+
+    for (auto buffer : traceThreadBuffers) {
+        os << separator << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->threadIndex
+            << ",\"args\":{\"name\":\"thread " << buffer->threadIndex << "\"}}";
+        separator = ",";
+
+        for (const auto& event : buffer->events) {
+            // microseconds with nanosecond resolution
+            os << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category
+                << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->threadIndex
+                << ",\"ts\":" << event.startNs / 1000 << '.' << std::to_string(1000 + event.startNs % 1000).substr(1)
+                << ",\"dur\":" << event.durationNs / 1000 << '.' << std::to_string(1000 + event.durationNs % 1000).substr(1);
+
+            if (event.id >= 0) {
+                os << ",\"args\":{\"id\":" << event.id << "}";
+            }
+
+            os << "}";
+        }
+
+        numDroppedEvents += buffer->numDroppedEvents;
+    }
+
+    os << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"numDroppedEvents\":\"" << numDroppedEvents << "\"}}\n";
+}
+
+}
+
+bool start(SizeType newCycleSampleInterval, SizeType newMaxNumEventsPerThread) {
+    bool expected = false;
+    if (!isClaimed.compare_exchange_strong(expected, true)) {
+        return false;
+    }
+
+    // no thread writes to its events: the previous trace waited for its recorders and enabled has been false since
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto buffer : traceThreadBuffers) {
+        std::vector<TraceEvent>().swap(buffer->events);
+    }
+
+    traceThreadBuffers.clear();
+    cycleSampleInterval.store(newCycleSampleInterval);
+    maxNumEventsPerThread = newMaxNumEventsPerThread;
+    startTicks.store(std::chrono::steady_clock::now().time_since_epoch().count());
+
+    generation.fetch_add(1);
+    enabled.store(true);
+
+    return true;
+}
+
+void stop() noexcept {
+    disable();
+    isClaimed.store(false);
+}
+
+bool isEnabled() noexcept {
+    return enabled.load(std::memory_order_acquire);
+}
+
+SizeType getCycleSampleInterval() noexcept {
+    return cycleSampleInterval.load(std::memory_order_relaxed);
+}
+
+uint64_t now() noexcept {
+    std::chrono::steady_clock::duration sinceStart(
+            std::chrono::steady_clock::now().time_since_epoch().count() - startTicks.load(std::memory_order_relaxed));
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(sinceStart).count();
+}
+
+void record(const TraceEvent& traceEvent) noexcept {
+    if (!isEnabled()) {
+        return;
+    }
+
+    try {
+        auto& buffer = getThreadBuffer();
+
+        // only this thread's cache line is written, see disable
+        buffer.isRecording.store(true);
+
+        // checked again, as the trace might have been stopped since
+        if (enabled.load()) {
+            try {
+                auto currentGeneration = generation.load(std::memory_order_relaxed);
+                if (buffer.generation != currentGeneration) {
+                    joinTrace(buffer, currentGeneration);
+                }
+
+                if (buffer.events.size() < maxNumEventsPerThread) {
+                    buffer.events.push_back(traceEvent);
+                } else {
+                    ++ buffer.numDroppedEvents;
+                }
+            } catch (const std::bad_alloc&) {
+                // the event is lost
+            }
+        }
+
+        buffer.isRecording.store(false, std::memory_order_release);
+    } catch (const std::bad_alloc&) {
+        // the event is lost
+    }
+}
+
+void finish(const std::string& path) {
+    disable();
+
+    try {
+        writeChromeTrace(path);
+    } catch (...) {
+        isClaimed.store(false);
+        throw;
+    }
+
+    isClaimed.store(false);
+}
+
+}
+
+namespace soft_npu {
+
+ScopedTraceSpan::ScopedTraceSpan(const char* name, const char* category, int64_t id) noexcept :
+        name(name),
+        category(category),
+        id(id),
+        isEnabled(Tracer::isEnabled()),
+        startNs(isEnabled ? Tracer::now() : 0) {
+}
+
+ScopedTraceSpan::~ScopedTraceSpan() {
+    if (isEnabled) {
+        Tracer::record({name, category, startNs, Tracer::now() - startNs, id});
+    }
+}
+
+TraceSession::TraceSession(std::string path, SizeType cycleSampleInterval) :
+        path(std::move(path)),
+        isOwner(!this->path.empty() && Tracer::start(cycleSampleInterval)) {
+}
+
+TraceSession::~TraceSession() {
+    if (isOwner) {
+        Tracer::stop();
+    }
+}
+
+bool TraceSession::finish() {
+    if (!isOwner) {
+        return false;
+    }
+
+    isOwner = false;
+    Tracer::finish(path);
+    return true;
+}
+
+}
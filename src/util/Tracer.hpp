@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Aliases.hpp>
+#include <cstdint>
+#include <string>
+
+namespace soft_npu {
+
+// name and category must be string literals, they are written out when the trace is exported
+struct TraceEvent {
+    const char* name;
+    const char* category;
+    uint64_t startNs;
+    uint64_t durationNs;
+    // written as the "id" argument unless negative
+    int64_t id;
+};
+
+// Process-wide collector of spans for Chrome trace event JSON (viewable in Perfetto or chrome://tracing). Every thread
+// records into its own buffer of bounded size, so recording takes no lock and writes no shared cache line; events beyond
+// the bound are dropped and counted. One trace is recorded at a time: start claims the tracer and finish or stop
+// releases it.
+namespace Tracer {
+
+// returns false, leaving the running trace untouched, if another trace is being recorded
+bool start(SizeType cycleSampleInterval, SizeType maxNumEventsPerThread = 1 << 20);
+
+// by the caller of a successful start only: stops recording, waits for spans being recorded by other threads to
+// complete and releases the tracer, finish writes the events to path beforehand
+void stop() noexcept;
+void finish(const std::string& path);
+
+bool isEnabled() noexcept;
+
+// cycle phases are traced in every cycleSampleInterval-th cycle only, 0 disables them
+SizeType getCycleSampleInterval() noexcept;
+
+// nanoseconds since start
+uint64_t now() noexcept;
+
+void record(const TraceEvent& traceEvent) noexcept;
+
+}
+
+// Records a trace for its lifetime if given a path and no other trace is being recorded, such as one of an enclosing
+// evolution run. The destructor stops recording without writing unless finish was called.
+class TraceSession {
+public:
+    TraceSession(std::string path, SizeType cycleSampleInterval);
+    ~TraceSession();
+
+    TraceSession(const TraceSession&) = delete;
+    TraceSession& operator=(const TraceSession&) = delete;
+
+    // writes the trace, returns false if this session does not own the tracer
+    bool finish();
+
+private:
+    const std::string path;
+    bool isOwner;
+};
+
+// records the enclosing scope as a span if tracing is enabled
+class ScopedTraceSpan {
+public:
+    ScopedTraceSpan(const char* name, const char* category, int64_t id = -1) noexcept;
+    ~ScopedTraceSpan();
+
+    ScopedTraceSpan(const ScopedTraceSpan&) = delete;
+    ScopedTraceSpan& operator=(const ScopedTraceSpan&) = delete;
+
+private:
+    const char* name;
+    const char* category;
+    const int64_t id;
+    const bool isEnabled;
+    const uint64_t startNs;
+};
+
+}
@@ -0,0 +1,60 @@
+#include "WorkerThreadPinner.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <pthread.h>
+#include <tbb/task_arena.h>
+
+namespace soft_npu {
+
+WorkerThreadPinner::WorkerThreadPinner(const std::vector<NumaNode>& numaNodes) {
+    SizeType maxNumCpusPerNode = 0;
+
+    for (const auto& numaNode : numaNodes) {
+        maxNumCpusPerNode = std::max(maxNumCpusPerNode, numaNode.cpuIds.size());
+    }
+
+    for (SizeType cpuIndex = 0; cpuIndex < maxNumCpusPerNode; ++cpuIndex) {
+        for (const auto& numaNode : numaNodes) {
+            if (cpuIndex < numaNode.cpuIds.size()) {
+                cpuIdsBySlot.push_back(numaNode.cpuIds[cpuIndex]);
+            }
+        }
+    }
+
+    if (cpuIdsBySlot.empty()) {
+        throw std::runtime_error("No CPUs to pin worker threads to");
+    }
+
+    // restored on scheduler exit and destruction, so it must be valid
+    auto errorNumber = pthread_getaffinity_np(pthread_self(), sizeof(originalCpuSet), &originalCpuSet);
+    if (errorNumber != 0) {
+        throw std::runtime_error(
+                "Cannot get the CPU affinity of the calling thread: " + std::string(std::strerror(errorNumber)));
+    }
+
+    observe(true);
+}
+
+WorkerThreadPinner::~WorkerThreadPinner() {
+    observe(false);
+    pthread_setaffinity_np(pthread_self(), sizeof(originalCpuSet), &originalCpuSet);
+}
+
+void WorkerThreadPinner::on_scheduler_entry(bool) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(getCpuIdForSlot(tbb::this_task_arena::current_thread_index()), &cpuSet);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+}
+
+void WorkerThreadPinner::on_scheduler_exit(bool) {
+    pthread_setaffinity_np(pthread_self(), sizeof(originalCpuSet), &originalCpuSet);
+}
+
+int WorkerThreadPinner::getCpuIdForSlot(SizeType slotIndex) const noexcept {
+    return cpuIdsBySlot[slotIndex % cpuIdsBySlot.size()];
+}
+
+}
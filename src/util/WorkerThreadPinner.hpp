@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+#include <sched.h>
+#include <tbb/task_scheduler_observer.h>
+#include <boost/core/noncopyable.hpp>
+#include "NumaTopology.hpp"
+
+namespace soft_npu {
+
+// Pins the threads of the calling thread's task arena while it is alive, one CPU per arena slot. Consecutive slots
+// go to different NUMA nodes, and memory is allocated on the node of the thread that first touches it, so a fitness
+// evaluation keeps its population and event buffers local to the thread running it.
+class WorkerThreadPinner : public tbb::task_scheduler_observer, private boost::noncopyable {
+public:
+    explicit WorkerThreadPinner(const std::vector<NumaNode>& numaNodes);
+    ~WorkerThreadPinner() override;
+
+    void on_scheduler_entry(bool isWorker) override;
+    void on_scheduler_exit(bool isWorker) override;
+
+    int getCpuIdForSlot(SizeType slotIndex) const noexcept;
+
+private:
+    std::vector<int> cpuIdsBySlot;
+    cpu_set_t originalCpuSet;
+};
+
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <Aliases.hpp>
+#include <util/BenchmarkComparison.hpp>
+
+using namespace soft_npu;
+
+ParamsType makeMetrics(const std::vector<double>& throughputSamples, const std::vector<double>& wallTimeSamples) {
+    ParamsType metrics;
+    metrics["throughput"]["higherIsBetter"] = true;
+    metrics["throughput"]["samples"] = throughputSamples;
+    metrics["wallTime"]["higherIsBetter"] = false;
+    metrics["wallTime"]["samples"] = wallTimeSamples;
+    return metrics;
+}
+
+const MetricComparison& findComparison(const std::vector<MetricComparison>& comparisons, const std::string& metricName) {
+    return *std::find_if(comparisons.cbegin(), comparisons.cend(), [&metricName](const auto& comparison) {
+        return comparison.metricName == metricName;
+    });
+}
+
+TEST(BenchmarkComparisonTest, MedianAndMAD) {
+    ASSERT_DOUBLE_EQ(BenchmarkComparison::median({3, 1, 2}), 2);
+    ASSERT_DOUBLE_EQ(BenchmarkComparison::median({4, 1, 3, 2}), 2.5);
+    ASSERT_DOUBLE_EQ(BenchmarkComparison::medianAbsoluteDeviation({1, 2, 3, 4, 100}), 1);
+    ASSERT_THROW(BenchmarkComparison::median({}), std::runtime_error);
+}
+
+TEST(BenchmarkComparisonTest, DetectsRegressionInEitherDirection) {
+    auto baseline = makeMetrics({100, 101, 99, 100, 100}, {1.0, 1.01, 0.99, 1.0, 1.0});
+    auto current = makeMetrics({90, 91, 89, 90, 90}, {1.1, 1.11, 1.09, 1.1, 1.1});
+
+    auto comparisons = BenchmarkComparison::compare(baseline, current, 0.05);
+    ASSERT_EQ(comparisons.size(), 2);
+
+    const auto& throughput = findComparison(comparisons, "throughput");
+    ASSERT_NEAR(throughput.relativeRegression, 0.1, 1e-12);
+    ASSERT_TRUE(throughput.isRegression);
+
+    const auto& wallTime = findComparison(comparisons, "wallTime");
+    ASSERT_NEAR(wallTime.relativeRegression, 0.1, 1e-12);
+    ASSERT_TRUE(wallTime.isRegression);
+
+    for (const auto& comparison : BenchmarkComparison::compare(current, baseline, 0.05)) {
+        ASSERT_FALSE(comparison.isRegression);
+        ASSERT_LT(comparison.relativeRegression, 0);
+    }
+}
+
+TEST(BenchmarkComparisonTest, ToleratesNoiseAndThreshold) {
+    auto baseline = makeMetrics({100, 100, 100}, {1.0, 1.0, 1.0});
+
+    // 10% slower, but within the run-to-run noise of the current result
+    auto noisy = makeMetrics({60, 90, 120}, {0.6, 1.1, 1.5});
+    for (const auto& comparison : BenchmarkComparison::compare(baseline, noisy, 0.05)) {
+        ASSERT_FALSE(comparison.isRegression);
+    }
+
+    // 3% slower without noise, below the threshold
+    auto slightlySlower = makeMetrics({97, 97, 97}, {1.03, 1.03, 1.03});
+    for (const auto& comparison : BenchmarkComparison::compare(baseline, slightlySlower, 0.05)) {
+        ASSERT_FALSE(comparison.isRegression);
+    }
+}
+
+TEST(BenchmarkComparisonTest, SkipsMetricsMissingFromBaseline) {
+    ParamsType baseline;
+    baseline["throughput"]["higherIsBetter"] = true;
+    baseline["throughput"]["samples"] = {100.0};
+
+    auto comparisons = BenchmarkComparison::compare(baseline, makeMetrics({50}, {2.0}), 0.05);
+    ASSERT_EQ(comparisons.size(), 1);
+    ASSERT_TRUE(comparisons.front().isRegression);
+}
+
+TEST(BenchmarkComparisonTest, ReportsMetricsMissingFromCurrentResult) {
+    auto baseline = makeMetrics({100}, {1.0});
+    baseline["wallTime.transmission events"]["higherIsBetter"] = false;
+    baseline["wallTime.transmission events"]["samples"] = {0.5};
+
+    auto comparisons = BenchmarkComparison::compare(baseline, makeMetrics({100}, {1.0}), 0.05);
+    ASSERT_EQ(comparisons.size(), 3);
+
+    const auto& missing = findComparison(comparisons, "wallTime.transmission events");
+    ASSERT_TRUE(missing.isMissing);
+    ASSERT_FALSE(findComparison(comparisons, "throughput").isMissing);
+}
+
+TEST(BenchmarkComparisonTest, RejectsInvalidLayout) {
+    auto current = makeMetrics({100}, {1.0});
+
+    ParamsType withoutSamples;
+    withoutSamples["throughput"]["higherIsBetter"] = true;
+    ASSERT_THROW(BenchmarkComparison::compare(withoutSamples, current, 0.05), std::runtime_error);
+
+    ParamsType emptySamples;
+    emptySamples["throughput"]["higherIsBetter"] = true;
+    emptySamples["throughput"]["samples"] = ParamsType::array();
+    ASSERT_THROW(BenchmarkComparison::compare(emptySamples, current, 0.05), std::runtime_error);
+
+    ASSERT_THROW(BenchmarkComparison::compare(ParamsType(), current, 0.05), std::runtime_error);
+    ASSERT_THROW(BenchmarkComparison::compare(current, ParamsType::array({1, 2}), 0.05), std::runtime_error);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <core/StaticInputSimulation.hpp>
+#include <util/ColumnarExport.hpp>
+#include <util/ColumnarTable.hpp>
+#include <TestUtil.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace soft_npu;
+
+struct TableContent {
+    ParamsType header;
+    std::vector<char> bytes;
+
+    template<typename T>
+    std::vector<T> getColumn(const std::string& name) const {
+        for (const auto& column : header["columns"]) {
+            if (column["name"] == name) {
+                SizeType numValues = 1;
+                for (SizeType extent : column["shape"]) {
+                    numValues *= extent;
+                }
+
+                std::vector<T> values(numValues);
+                std::memcpy(values.data(), bytes.data() + column["offset"].get<SizeType>(), numValues * sizeof(T));
+                return values;
+            }
+        }
+
+        throw std::runtime_error("Missing column: " + name);
+    }
+};
+
+static TableContent readTable(const std::string& path) {
+    std::ifstream is(path, std::ios::binary);
+    TableContent tableContent;
+    tableContent.bytes = {std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+
+    uint64_t headerLength;
+    std::memcpy(&headerLength, tableContent.bytes.data() + 8, sizeof(headerLength));
+    tableContent.header = ParamsType::parse(std::string(tableContent.bytes.data() + 16, headerLength));
+
+    EXPECT_EQ(std::string(tableContent.bytes.data(), 8), "SNPCOLS1");
+    return tableContent;
+}
+
+TEST(ColumnarExportTest, TableLayout) {
+    ColumnarTable table(3);
+    table.setAttribute("name", "test");
+    table.addColumn("a", std::vector<double>{1.5, 2.5, 3.5});
+    table.addColumn("b", std::vector<uint8_t>{1, 0, 1});
+    table.addColumn("c", std::vector<uint64_t>{1, 2, 3, 4, 5, 6}, 2);
+    ASSERT_THROW(table.addColumn("d", std::vector<double>{1}), std::runtime_error);
+
+    table.write("columnarTableTest.snpc");
+    auto tableContent = readTable("columnarTableTest.snpc");
+    std::remove("columnarTableTest.snpc");
+
+    const auto& header = tableContent.header;
+    ASSERT_EQ(header["numRows"], 3);
+    ASSERT_EQ(header["attributes"]["name"], "test");
+    ASSERT_EQ(header["columns"][0]["dtype"], "<f8");
+    ASSERT_EQ(header["columns"][1]["dtype"], "|u1");
+    ASSERT_EQ(header["columns"][2]["shape"], ParamsType({3, 2}));
+
+    for (const auto& column : header["columns"]) {
+        ASSERT_EQ(column["offset"].get<SizeType>() % 64, 0);
+    }
+
+    ASSERT_EQ(tableContent.getColumn<double>("a"), std::vector<double>({1.5, 2.5, 3.5}));
+    ASSERT_EQ(tableContent.getColumn<uint8_t>("b"), std::vector<uint8_t>({1, 0, 1}));
+    ASSERT_EQ(tableContent.getColumn<uint64_t>("c"), std::vector<uint64_t>({1, 2, 3, 4, 5, 6}));
+}
+
+TEST(ColumnarExportTest, SimulationResult) {
+    auto params = getStimulatedP1000Params();
+    (*params)["simulation"]["untilTime"] = 0.1;
+
+    StaticInputSimulation simulation(params);
+    simulation.probeVoltages({1, 2}, 1e-3);
+    auto simulationResult = simulation.run();
+
+    std::string directoryPath = "columnarExportTest";
+    ColumnarExport::writeSimulationResult(directoryPath, simulationResult);
+
+    auto summary = readTable(directoryPath + "/summary.snpc");
+    auto spikes = readTable(directoryPath + "/spikes.snpc");
+    auto neurons = readTable(directoryPath + "/neurons.snpc");
+    auto synapses = readTable(directoryPath + "/synapses.snpc");
+    auto voltageSamples = readTable(directoryPath + "/voltageSamples.snpc");
+    auto eventLoadHistograms = readTable(directoryPath + "/eventLoadHistograms.snpc");
+    std::filesystem::remove_all(directoryPath);
+
+    ASSERT_EQ(summary.header["attributes"]["numExcitatorySpikes"], simulationResult.numExcitatorySpikes);
+
+    auto spikeTimes = spikes.getColumn<TimeType>("time");
+    auto spikeNeuronIds = spikes.getColumn<uint64_t>("neuronId");
+    ASSERT_EQ(spikeTimes.size(), simulationResult.recordedSpikes.size());
+    ASSERT_GT(spikeTimes.size(), 0);
+
+    for (SizeType i = 0; i < spikeTimes.size(); ++i) {
+        ASSERT_EQ(spikeTimes[i], simulationResult.recordedSpikes[i].time);
+        ASSERT_EQ(spikeNeuronIds[i], simulationResult.recordedSpikes[i].neuronId);
+    }
+
+    auto isInhibitory = neurons.getColumn<uint8_t>("isInhibitory");
+    ASSERT_EQ(isInhibitory.size(), 1000);
+    ASSERT_EQ(neurons.header["columns"][1]["dtype"], "|b1");
+    ASSERT_EQ(isInhibitory[999], simulationResult.neuronInfos[999].isInhibitory);
+    ASSERT_EQ(neurons.getColumn<ValueType>("locationX")[7], simulationResult.locationsIndexedByNeuronId[7][0]);
+
+    auto weights = synapses.getColumn<ValueType>("weight");
+    ASSERT_EQ(weights.size(), simulationResult.finalSynapseInfos.size());
+    ASSERT_EQ(weights.back(), simulationResult.finalSynapseInfos.back().weight);
+
+    ASSERT_EQ(voltageSamples.header["attributes"]["neuronIds"], ParamsType({1, 2}));
+    ASSERT_EQ(voltageSamples.getColumn<ValueType>("voltage"), simulationResult.voltageSamples.voltages);
+
+    auto numCycles = eventLoadHistograms.getColumn<uint64_t>("numCycles");
+    const auto& histogram = simulationResult.eventLoadStats.getQueueLoadStats(EventQueue::commonEvents).getHistogram();
+    auto queueIndex = static_cast<SizeType>(EventQueue::commonEvents);
+    auto numQueues = static_cast<SizeType>(EventQueue::numQueues);
+
+    for (SizeType bucket = 0; bucket < QueueLoadStats::numBuckets; ++bucket) {
+        ASSERT_EQ(numCycles[bucket * numQueues + queueIndex], histogram[bucket]);
+    }
+}
@@ -0,0 +1,65 @@
+#include <Aliases.hpp>
+#include <util/CounterBasedRandomEngine.hpp>
+#include "gtest/gtest.h"
+#include <random>
+#include <vector>
+
+using namespace soft_npu;
+
+TEST(CounterBasedRandomEngineTest, KnownAnswers) {
+    using Block = CounterBasedRandomEngine::BlockType;
+
+    ASSERT_EQ(CounterBasedRandomEngine::generateBlock({0, 0, 0, 0}, {0, 0}),
+              (Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+
+    ASSERT_EQ(CounterBasedRandomEngine::generateBlock(
+            {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+              (Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+
+    ASSERT_EQ(CounterBasedRandomEngine::generateBlock(
+            {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+              (Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+std::vector<uint32_t> draw(CounterBasedRandomEngine randomEngine, SizeType numDraws) {
+    std::vector<uint32_t> rv;
+
+    for (SizeType i = 0; i < numDraws; ++i) {
+        rv.push_back(randomEngine());
+    }
+
+    return rv;
+}
+
+TEST(CounterBasedRandomEngineTest, StreamAddressing) {
+    using Subsystem = CounterBasedRandomEngine::Subsystem;
+
+    auto reference = draw(CounterBasedRandomEngine(42, Subsystem::populationGeneration, 7, 3), 10);
+
+    ASSERT_EQ(reference, draw(CounterBasedRandomEngine(42, Subsystem::populationGeneration, 7, 3), 10));
+    ASSERT_NE(reference, draw(CounterBasedRandomEngine(43, Subsystem::populationGeneration, 7, 3), 10));
+    ASSERT_NE(reference, draw(CounterBasedRandomEngine(42, Subsystem::nonCoherentStimulation, 7, 3), 10));
+    ASSERT_NE(reference, draw(CounterBasedRandomEngine(42, Subsystem::populationGeneration, 8, 3), 10));
+    ASSERT_NE(reference, draw(CounterBasedRandomEngine(42, Subsystem::populationGeneration, 7, 4), 10));
+
+    CounterBasedRandomEngine randomEngine(42, Subsystem::populationGeneration, 7, 3);
+    randomEngine.discard(6);
+    ASSERT_EQ(randomEngine(), reference[6]);
+}
+
+TEST(CounterBasedRandomEngineTest, UniformDistribution) {
+    CounterBasedRandomEngine randomEngine(1, CounterBasedRandomEngine::Subsystem::nonCoherentStimulation, 0, 0);
+    std::uniform_real_distribution<double> uniformDistribution;
+
+    constexpr SizeType numDraws = 100000;
+    double sum = 0;
+
+    for (SizeType i = 0; i < numDraws; ++i) {
+        auto value = uniformDistribution(randomEngine);
+        ASSERT_GE(value, 0.0);
+        ASSERT_LT(value, 1.0);
+        sum += value;
+    }
+
+    ASSERT_NEAR(sum / numDraws, 0.5, 0.01);
+}
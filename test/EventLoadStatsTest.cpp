@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <core/EventLoadStats.hpp>
+#include <core/StaticInputSimulation.hpp>
+#include <TestUtil.hpp>
+#include <numeric>
+
+using namespace soft_npu;
+
+TEST(EventLoadStatsTest, HistogramBuckets) {
+    QueueLoadStats queueLoadStats;
+
+    for (SizeType size : {0, 1, 2, 3, 4, 1000}) {
+        queueLoadStats.record(size);
+    }
+
+    const auto& histogram = queueLoadStats.getHistogram();
+    ASSERT_EQ(histogram[0], 1);
+    ASSERT_EQ(histogram[1], 1);
+    ASSERT_EQ(histogram[2], 2);
+    ASSERT_EQ(histogram[3], 1);
+    ASSERT_EQ(histogram[10], 1);
+    ASSERT_EQ(QueueLoadStats::getBucketLowerBound(10), 512);
+    ASSERT_EQ(queueLoadStats.getHighWaterMark(), 1000);
+}
+
+TEST(EventLoadStatsTest, SamplesTrackIntervalMaxima) {
+    EventLoadStats eventLoadStats(2);
+
+    eventLoadStats.record(EventQueue::commonEvents, 3);
+    eventLoadStats.onCycleEnd(1);
+    eventLoadStats.record(EventQueue::commonEvents, 1);
+    eventLoadStats.onCycleEnd(2);
+    eventLoadStats.record(EventQueue::commonEvents, 2);
+    eventLoadStats.onCycleEnd(3);
+    eventLoadStats.onCycleEnd(4);
+
+    const auto& samples = eventLoadStats.getSamples();
+    auto queueIndex = static_cast<SizeType>(EventQueue::commonEvents);
+
+    ASSERT_EQ(samples.size(), 2);
+    ASSERT_EQ(samples[0].time, 2);
+    ASSERT_EQ(samples[0].maxSizes[queueIndex], 3);
+    ASSERT_EQ(samples[1].maxSizes[queueIndex], 2);
+    ASSERT_EQ(eventLoadStats.getQueueLoadStats(EventQueue::commonEvents).getHighWaterMark(), 3);
+}
+
+TEST(EventLoadStatsTest, Merge) {
+    EventLoadStats eventLoadStats(1);
+    EventLoadStats otherEventLoadStats(1);
+
+    eventLoadStats.record(EventQueue::commonEvents, 3);
+    eventLoadStats.onCycleEnd(1);
+    otherEventLoadStats.record(EventQueue::commonEvents, 5);
+    otherEventLoadStats.onCycleEnd(1);
+
+    eventLoadStats.merge(otherEventLoadStats);
+
+    const auto& queueLoadStats = eventLoadStats.getQueueLoadStats(EventQueue::commonEvents);
+    auto queueIndex = static_cast<SizeType>(EventQueue::commonEvents);
+
+    ASSERT_EQ(queueLoadStats.getHighWaterMark(), 5);
+    ASSERT_EQ(queueLoadStats.getHistogram()[2], 1);
+    ASSERT_EQ(queueLoadStats.getHistogram()[3], 1);
+    ASSERT_EQ(eventLoadStats.getSamples().size(), 1);
+    ASSERT_EQ(eventLoadStats.getSamples()[0].maxSizes[queueIndex], 5);
+}
+
+TEST(EventLoadStatsTest, RecordedBySimulation) {
+    auto params = getStimulatedP1000Params();
+    (*params)["eventProcessor"]["loadSampleInterval"] = 0.1;
+
+    StaticInputSimulation simulation(params);
+    auto simulationResult = simulation.run();
+    const auto& eventLoadStats = simulationResult.eventLoadStats;
+
+    ASSERT_EQ(eventLoadStats.getSamples().size(), 10);
+
+    for (SizeType queue = 0; queue < static_cast<SizeType>(EventQueue::numQueues); ++queue) {
+        const auto& queueLoadStats = eventLoadStats.getQueueLoadStats(static_cast<EventQueue>(queue));
+        const auto& histogram = queueLoadStats.getHistogram();
+
+        SizeType maxSampledSize = 0;
+
+        for (const auto& sample : eventLoadStats.getSamples()) {
+            maxSampledSize = std::max(maxSampledSize, sample.maxSizes[queue]);
+        }
+
+        ASSERT_EQ(std::accumulate(histogram.cbegin(), histogram.cend(), static_cast<SizeType>(0)), 10000);
+        ASSERT_EQ(queueLoadStats.getHighWaterMark(), maxSampledSize);
+    }
+
+    ASSERT_GT(eventLoadStats.getQueueLoadStats(EventQueue::transmissionEventsPerSlot).getHighWaterMark(), 0);
+    ASSERT_GT(eventLoadStats.getQueueLoadStats(EventQueue::eligibilityTraces).getHighWaterMark(), 0);
+}
+
+TEST(EventLoadStatsTest, RecordedInInferenceMode) {
+    auto params = getStimulatedP1000Params();
+    (*params)["simulation"]["inferenceMode"] = true;
+
+    StaticInputSimulation simulation(params);
+    auto simulationResult = simulation.run();
+    const auto& queueLoadStats = simulationResult.eventLoadStats.getQueueLoadStats(EventQueue::eligibilityTraces);
+    const auto& histogram = queueLoadStats.getHistogram();
+
+    ASSERT_EQ(std::accumulate(histogram.cbegin(), histogram.cend(), static_cast<SizeType>(0)), 10000);
+    ASSERT_EQ(queueLoadStats.getHighWaterMark(), 0);
+}
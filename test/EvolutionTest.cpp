@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <evolution/Evolution.hpp>
+#include <algorithm>
+#include <mutex>
 
 using namespace soft_npu;
 
@@ -51,3 +53,71 @@ TEST(EvolutionTest, SimpleOptimizationProblem) {
     ASSERT_NEAR((*result.topGeneValue)["x"], 2.5, 1e-1);
     ASSERT_DOUBLE_EQ((*result.topGeneValue)["y"], 0);
 }
+
+// the fitness function of SimpleOptimizationProblem, recording the seeds of each batch
+struct BatchRecordingFitnessFunction : public FitnessFunction {
+    double evaluate(const ParamsType& geneValue, SizeType) const override {
+        double x = geneValue["x"];
+        return - x * (5-x) + 2.5 * 2.5;
+    }
+
+    std::vector<double> evaluateBatch(const std::vector<const ParamsType*>& geneValues, SizeType randomSeed) const override {
+        std::lock_guard<std::mutex> lock(mutex);
+        batchSizes.push_back(geneValues.size());
+        batchSeeds.push_back(randomSeed);
+        return FitnessFunction::evaluateBatch(geneValues, randomSeed);
+    }
+
+    mutable std::mutex mutex;
+    mutable std::vector<SizeType> batchSizes;
+    mutable std::vector<SizeType> batchSeeds;
+};
+
+TEST(EvolutionTest, BatchedFitnessEvaluation) {
+    EvolutionParams evolutionParams;
+
+    evolutionParams.maxNumIterations = 10000;
+    evolutionParams.targetFitnessValue = 1e-6;
+    evolutionParams.populationSize = 100;
+    evolutionParams.eliteSize = 5;
+    evolutionParams.resultExtractionNumEvalSeeds = 5;
+    evolutionParams.resultExtractionNumCandidates = 5;
+    evolutionParams.fitnessBatchSize = 8;
+
+    auto geneInfoJson = R"(
+
+[
+    {
+        "id": "x",
+        "prototypeValue": 0.0,
+        "minValue": 0.0,
+        "maxValue": 20.0
+    }
+]
+
+)"_json;
+
+    BatchRecordingFitnessFunction fitnessFunction;
+
+    auto result = Evolution::runImpl(evolutionParams, fitnessFunction, geneInfoJson);
+    ASSERT_EQ(result.terminationReason, TerminationReason::targetFitnessValueReached);
+    ASSERT_NEAR((*result.topGeneValue)["x"], 2.5, 1e-1);
+
+    // 12 full batches and one of 4 candidates per generation, each batch with its own seed
+    ASSERT_EQ(fitnessFunction.batchSizes.size() % 13, 0);
+    ASSERT_EQ(std::count(fitnessFunction.batchSizes.cbegin(), fitnessFunction.batchSizes.cend(), 8), fitnessFunction.batchSizes.size() / 13 * 12);
+    ASSERT_EQ(std::count(fitnessFunction.batchSizes.cbegin(), fitnessFunction.batchSizes.cend(), 4), fitnessFunction.batchSizes.size() / 13);
+
+    std::sort(fitnessFunction.batchSeeds.begin(), fitnessFunction.batchSeeds.end());
+    ASSERT_EQ(std::unique(fitnessFunction.batchSeeds.begin(), fitnessFunction.batchSeeds.end()), fitnessFunction.batchSeeds.end());
+}
+
+TEST(EvolutionTest, InvalidFitnessBatchSize) {
+    EvolutionParams evolutionParams;
+    evolutionParams.maxNumIterations = 0;
+    evolutionParams.fitnessBatchSize = 0;
+
+    BatchRecordingFitnessFunction fitnessFunction;
+
+    ASSERT_THROW(Evolution::runImpl(evolutionParams, fitnessFunction, R"([{"id": "x", "prototypeValue": 0.0, "minValue": 0.0, "maxValue": 1.0}])"_json), std::runtime_error);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <core/CycleController.hpp>
+#include <core/CycleOutputBuffer.hpp>
+#include <core/FiringRateMonitor.hpp>
+#include <core/StaticInputSimulation.hpp>
+#include <TestUtil.hpp>
+
+using namespace soft_npu;
+
+static void runCycle(
+        FiringRateMonitor& firingRateMonitor,
+        const std::vector<SizeType>& spikingNeuronIds,
+        const std::vector<SizeType>& spikingChannelIds = {}) {
+
+    CycleOutputBuffer cycleOutputBuffer;
+
+    for (auto neuronId : spikingNeuronIds) {
+        cycleOutputBuffer.addNeuronSpike(neuronId);
+    }
+
+    for (auto channelId : spikingChannelIds) {
+        cycleOutputBuffer.addSpike(channelId);
+    }
+
+    firingRateMonitor.onCycleEnd(cycleOutputBuffer);
+}
+
+TEST(FiringRateMonitorTest, SlidingWindow) {
+    // bins of 2 cycles of 1 ms, window of 2 bins
+    FiringRateMonitor firingRateMonitor(1e-3, 2, 2, {{"a", {0, 1}}, {"b", {1}}});
+
+    ASSERT_TRUE(firingRateMonitor.isEnabled());
+    ASSERT_EQ(firingRateMonitor.getNeuronGroupIndex("b"), 1);
+    ASSERT_THROW(firingRateMonitor.getNeuronGroupIndex("c"), std::runtime_error);
+
+    runCycle(firingRateMonitor, {0, 1});
+    ASSERT_EQ(firingRateMonitor.getWindowDuration(), 0);
+    ASSERT_EQ(firingRateMonitor.getFiringRate("a"), 0);
+
+    runCycle(firingRateMonitor, {1}, {3});
+    ASSERT_DOUBLE_EQ(firingRateMonitor.getWindowDuration(), 2e-3);
+    ASSERT_DOUBLE_EQ(firingRateMonitor.getFiringRate("a"), 3 / 2e-3 / 2);
+    ASSERT_DOUBLE_EQ(firingRateMonitor.getFiringRate("b"), 2 / 2e-3);
+    ASSERT_EQ(firingRateMonitor.getNumOutputChannels(), 4);
+    ASSERT_DOUBLE_EQ(firingRateMonitor.getOutputChannelRate(3), 1 / 2e-3);
+    ASSERT_EQ(firingRateMonitor.getOutputChannelRate(0), 0);
+
+    runCycle(firingRateMonitor, {});
+    runCycle(firingRateMonitor, {0});
+    ASSERT_DOUBLE_EQ(firingRateMonitor.getWindowDuration(), 4e-3);
+    ASSERT_DOUBLE_EQ(firingRateMonitor.getFiringRate("a"), 4 / 4e-3 / 2);
+    ASSERT_DOUBLE_EQ(firingRateMonitor.getMaxFiringRate(), 2 / 4e-3);
+
+    // the first bin is evicted
+    runCycle(firingRateMonitor, {});
+    runCycle(firingRateMonitor, {});
+    ASSERT_DOUBLE_EQ(firingRateMonitor.getWindowDuration(), 4e-3);
+    ASSERT_DOUBLE_EQ(firingRateMonitor.getFiringRate("a"), 1 / 4e-3 / 2);
+    ASSERT_EQ(firingRateMonitor.getFiringRate("b"), 0);
+    ASSERT_EQ(firingRateMonitor.getOutputChannelRate(3), 0);
+}
+
+TEST(FiringRateMonitorTest, DisabledByDefault) {
+    FiringRateMonitor firingRateMonitor;
+    runCycle(firingRateMonitor, {0}, {0});
+
+    ASSERT_FALSE(firingRateMonitor.isEnabled());
+    ASSERT_EQ(firingRateMonitor.getNumNeuronGroups(), 0);
+    ASSERT_EQ(firingRateMonitor.getMaxFiringRate(), 0);
+}
+
+class MonitoredSimulation : public StaticInputSimulation {
+public:
+    using StaticInputSimulation::StaticInputSimulation;
+
+    void runController(
+            CycleController& controller,
+            Population& population,
+            TimeType simulationTime,
+            SynapticTransmissionStats& synapticTransmissionStats) override {
+        StaticInputSimulation::runController(controller, population, simulationTime, synapticTransmissionStats);
+
+        const auto& firingRateMonitor = controller.getFiringRateMonitor();
+        excitatoryFiringRate = firingRateMonitor.getFiringRate("excitatory");
+        inhibitoryFiringRate = firingRateMonitor.getFiringRate("inhibitory");
+        windowDuration = firingRateMonitor.getWindowDuration();
+    }
+
+    double excitatoryFiringRate = 0;
+    double inhibitoryFiringRate = 0;
+    TimeType windowDuration = 0;
+};
+
+TEST(FiringRateMonitorTest, FullWindowMatchesMeanFiringRates) {
+    auto params = getStimulatedP1000Params();
+    (*params)["firingRateMonitor"]["window"] = 1.0;
+
+    MonitoredSimulation simulation(params);
+    auto simulationResult = simulation.run();
+
+    ASSERT_NEAR(simulation.windowDuration, 1.0, 1e-9);
+    ASSERT_GT(simulation.excitatoryFiringRate, 0);
+    ASSERT_NEAR(simulation.excitatoryFiringRate, simulationResult.meanExcitatoryFiringRate, 1e-6);
+    ASSERT_NEAR(simulation.inhibitoryFiringRate, simulationResult.meanInhibitoryFiringRate, 1e-6);
+}
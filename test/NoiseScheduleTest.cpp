@@ -0,0 +1,45 @@
+#include <Aliases.hpp>
+#include <core/NoiseSchedule.hpp>
+#include "gtest/gtest.h"
+#include <vector>
+
+using namespace soft_npu;
+
+std::vector<SizeType> getScheduledNeuronIndices(NoiseSchedule& noiseSchedule, SizeType cycleId) {
+    std::vector<SizeType> rv;
+    noiseSchedule.forEachNeuronIndex(cycleId, [&rv](SizeType neuronIdx) {
+        rv.push_back(neuronIdx);
+    });
+    return rv;
+}
+
+std::vector<SizeType> getDrawnNeuronIndices(uint64_t seed, SizeType cycleId, SizeType numNeurons, ValueType lambda) {
+    std::vector<SizeType> rv;
+    std::poisson_distribution<SizeType> poissonDistribution(lambda);
+    drawNoiseCycle(seed, cycleId, numNeurons, poissonDistribution, rv);
+    return rv;
+}
+
+TEST(NoiseScheduleTest, MatchesInlineDraws) {
+    constexpr uint64_t seed = 3;
+    constexpr SizeType numNeurons = 100;
+
+    NoiseSchedule noiseSchedule(seed, numNeurons, 3, 2);
+    noiseSchedule.start(0, 2.0);
+
+    SizeType numScheduledSpikes = 0;
+
+    for (SizeType cycleId = 0; cycleId < 1000; ++cycleId) {
+        auto neuronIndices = getScheduledNeuronIndices(noiseSchedule, cycleId);
+        ASSERT_EQ(neuronIndices, getDrawnNeuronIndices(seed, cycleId, numNeurons, 2.0));
+        numScheduledSpikes += neuronIndices.size();
+    }
+
+    ASSERT_NEAR(numScheduledSpikes / 1000.0, 2.0, 0.2);
+
+    noiseSchedule.start(1000, 0.5);
+
+    for (SizeType cycleId = 1000; cycleId < 2000; cycleId += 7) {
+        ASSERT_EQ(getScheduledNeuronIndices(noiseSchedule, cycleId), getDrawnNeuronIndices(seed, cycleId, numNeurons, 0.5));
+    }
+}
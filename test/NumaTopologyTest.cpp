@@ -0,0 +1,34 @@
+#include <gtest/gtest.h>
+#include <util/NumaTopology.hpp>
+#include <util/WorkerThreadPinner.hpp>
+#include <algorithm>
+
+using namespace soft_npu;
+
+TEST(NumaTopologyTest, ParseCpuList) {
+    ASSERT_EQ(NumaTopology::parseCpuList("0-3,8,10-11\n"), std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+    ASSERT_EQ(NumaTopology::parseCpuList("5"), std::vector<int>({5}));
+    ASSERT_TRUE(NumaTopology::parseCpuList("").empty());
+}
+
+TEST(NumaTopologyTest, NodesCoverAllowedCpus) {
+    auto numaNodes = NumaTopology::readNumaNodes();
+    ASSERT_FALSE(numaNodes.empty());
+
+    for (const auto& numaNode : numaNodes) {
+        ASSERT_FALSE(numaNode.cpuIds.empty());
+    }
+}
+
+TEST(NumaTopologyTest, SlotsAlternateBetweenNodes) {
+    std::vector<NumaNode> numaNodes = {{0, {0, 1, 2}}, {1, {4, 5}}};
+    WorkerThreadPinner workerThreadPinner(numaNodes);
+
+    std::vector<int> cpuIds;
+
+    for (SizeType slotIndex = 0; slotIndex < 6; ++slotIndex) {
+        cpuIds.push_back(workerThreadPinner.getCpuIdForSlot(slotIndex));
+    }
+
+    ASSERT_EQ(cpuIds, std::vector<int>({0, 4, 1, 5, 2, 0}));
+}
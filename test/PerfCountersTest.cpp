@@ -0,0 +1,22 @@
+#include <gtest/gtest.h>
+#include <core/PerfCounters.hpp>
+
+using namespace soft_npu;
+
+TEST(PerfCountersTest, ScaledToTimeEnabled) {
+    PerfCounts counts;
+    counts.cycles = 1000;
+    counts.instructions = 3000;
+    counts.timeEnabled = 400;
+    counts.timeRunning = 100;
+
+    auto scaled = counts.getScaled();
+    ASSERT_FALSE(scaled.isUnavailable());
+    ASSERT_EQ(scaled.cycles, 4000);
+    ASSERT_EQ(scaled.instructions, 12000);
+    ASSERT_EQ(scaled.branchMisses, 0);
+
+    counts.timeRunning = 0;
+    ASSERT_TRUE(counts.getScaled().isUnavailable());
+    ASSERT_EQ(counts.getScaled().cycles, 1000);
+}
@@ -3,7 +3,10 @@
 #include <Aliases.hpp>
 #include <genesis/PopulationGeneratorFactory.hpp>
 #include <genesis/CloningPopulationGenerator.hpp>
+#include <genesis/NeuronOrdering.hpp>
 #include <neuro/Synapse.hpp>
+#include <core/StaticInputSimulation.hpp>
+#include <numeric>
 
 using namespace soft_npu;
 
@@ -101,8 +104,8 @@ TEST(PopulationGeneratorTests, R2DSheetTest) {
             for (auto synIt = sourceNeuron->cbeginOutboundSynapses(); synIt != sourceNeuron->cendOutboundSynapses(); ++ synIt) {
                 auto& synapse = *synIt;
 
-                ASSERT_TRUE(synapse->conductionDelay >= std::numeric_limits<ValueType>::epsilon());
-                ASSERT_TRUE(synapse->conductionDelay <= 10e-3 - std::numeric_limits<ValueType>::epsilon());
+                ASSERT_TRUE(synapse->conductionDelay >= std::numeric_limits<TimeType>::epsilon());
+                ASSERT_TRUE(synapse->conductionDelay <= 10e-3 - std::numeric_limits<TimeType>::epsilon());
             }
 
             std::vector<SizeType> distantNeuronIds;
@@ -155,3 +158,144 @@ TEST(PopulationGeneratorTests, R2DSheetTest) {
 
     ASSERT_TRUE(countIncompleteTargetProjections < 2500); // just a ballpark
 }
+
+std::vector<SizeType> getGeneratorOrder(const Population& population) {
+    std::vector<SizeType> generatorOrder(population.getPopulationSize());
+    std::iota(generatorOrder.begin(), generatorOrder.end(), 0);
+    return generatorOrder;
+}
+
+TEST(PopulationGeneratorTests, ReverseCuthillMcKeeChain) {
+    auto populationJson = R"(
+{
+    "neurons": [
+        {"neuronId": 0, "neuronParamsName": "excitatory"},
+        {"neuronId": 1, "neuronParamsName": "excitatory"},
+        {"neuronId": 2, "neuronParamsName": "excitatory"},
+        {"neuronId": 3, "neuronParamsName": "excitatory"},
+        {"neuronId": 4, "neuronParamsName": "excitatory"}
+    ],
+    "synapses": [
+        {"preSynapticNeuronId": 0, "postSynapticNeuronId": 3, "initialWeight": 0.1, "conductionDelay": 1e-3},
+        {"preSynapticNeuronId": 3, "postSynapticNeuronId": 1, "initialWeight": 0.1, "conductionDelay": 1e-3},
+        {"preSynapticNeuronId": 1, "postSynapticNeuronId": 4, "initialWeight": 0.1, "conductionDelay": 1e-3},
+        {"preSynapticNeuronId": 4, "postSynapticNeuronId": 2, "initialWeight": 0.1, "conductionDelay": 1e-3}
+    ]
+}
+)"_json;
+
+    auto params = getTemplateParams();
+    (*params)["simulation"]["populationGenerator"] = "pDetailedParams";
+    (*params)["populationGenerators"]["pDetailedParams"] = populationJson;
+
+    RandomEngineType randomEngine;
+    auto population = PopulationGeneratorFactory::createFromParams(*params, randomEngine)->generatePopulation();
+
+    auto storageOrder = NeuronOrdering::reverseCuthillMcKee(*population);
+
+    ASSERT_EQ(storageOrder.size(), 5);
+    ASSERT_FLOAT_EQ(NeuronOrdering::getMeanSynapticSpan(*population, getGeneratorOrder(*population)), 2.5);
+    ASSERT_FLOAT_EQ(NeuronOrdering::getMeanSynapticSpan(*population, storageOrder), 1);
+}
+
+TEST(PopulationGeneratorTests, ReorderingPreservesTopology) {
+    auto params = getTemplateParams();
+    (*params)["simulation"]["populationGenerator"] = "r2dSheet";
+    (*params)["populationGenerators"]["r2dSheet"]["numNeurons"] = 2000;
+
+    auto reorderedParams = std::make_shared<ParamsType>(*params);
+    (*reorderedParams)["simulation"]["neuronOrdering"] = "hilbert";
+
+    RandomEngineType randomEngine;
+    auto population = PopulationGeneratorFactory::createFromParams(*params, randomEngine)->generatePopulation();
+
+    RandomEngineType reorderedRandomEngine;
+    auto reorderedPopulation = PopulationGeneratorFactory::createFromParams(
+            *reorderedParams, reorderedRandomEngine)->generatePopulation();
+
+    ASSERT_EQ(reorderedPopulation->getPopulationSize(), population->getPopulationSize());
+    ASSERT_EQ(reorderedPopulation->getMotorNeuronIds(), population->getMotorNeuronIds());
+
+    for (SizeType neuronId = 0; neuronId < population->getPopulationSize(); ++neuronId) {
+        const auto& neuron = population->getNeuronById(neuronId);
+        const auto& reorderedNeuron = reorderedPopulation->getNeuronById(neuronId);
+
+        ASSERT_EQ(reorderedNeuron.getNeuronId(), neuronId);
+        ASSERT_EQ(reorderedNeuron.getNeuronParams()->isInhibitory, neuron.getNeuronParams()->isInhibitory);
+        ASSERT_EQ(reorderedPopulation->getCellLocation(neuronId), population->getCellLocation(neuronId));
+        ASSERT_EQ(
+                std::distance(reorderedNeuron.cbeginOutboundSynapses(), reorderedNeuron.cendOutboundSynapses()),
+                std::distance(neuron.cbeginOutboundSynapses(), neuron.cendOutboundSynapses()));
+
+        for (auto synIt = neuron.cbeginOutboundSynapses(), reorderedSynIt = reorderedNeuron.cbeginOutboundSynapses();
+                synIt != neuron.cendOutboundSynapses(); ++synIt, ++reorderedSynIt) {
+            ASSERT_EQ((*reorderedSynIt)->preSynapticNeuron, &reorderedNeuron);
+            ASSERT_EQ((*reorderedSynIt)->postSynapticNeuron->getNeuronId(), (*synIt)->postSynapticNeuron->getNeuronId());
+            ASSERT_EQ((*reorderedSynIt)->postSynapticNeuron, &reorderedPopulation->getNeuronById((*synIt)->postSynapticNeuron->getNeuronId()));
+            ASSERT_EQ((*reorderedSynIt)->conductionDelay, (*synIt)->conductionDelay);
+            ASSERT_EQ((*reorderedSynIt)->weight, (*synIt)->weight);
+        }
+    }
+
+    ASSERT_LT(
+            NeuronOrdering::getMeanSynapticSpan(*population, NeuronOrdering::hilbertCurve(*population)),
+            0.5 * NeuronOrdering::getMeanSynapticSpan(*population, getGeneratorOrder(*population)));
+}
+
+TEST(PopulationGeneratorTests, ReorderingPreservesSimulationResult) {
+    auto params = getTemplateParams();
+    (*params)["simulation"]["populationGenerator"] = "p1000";
+    (*params)["simulation"]["untilTime"] = 0.5;
+    (*params)["nonCoherentStimulator"]["rate"] = 10.0;
+
+    auto reorderedParams = std::make_shared<ParamsType>(*params);
+    (*reorderedParams)["simulation"]["neuronOrdering"] = "rcm";
+
+    StaticInputSimulation simulation(params);
+    auto simulationResult = simulation.run();
+
+    StaticInputSimulation reorderedSimulation(reorderedParams);
+    auto reorderedSimulationResult = reorderedSimulation.run();
+
+    ASSERT_FALSE(simulationResult.recordedSpikes.empty());
+    ASSERT_EQ(reorderedSimulationResult.recordedSpikes.size(), simulationResult.recordedSpikes.size());
+
+    for (SizeType i = 0; i < simulationResult.recordedSpikes.size(); ++i) {
+        ASSERT_EQ(reorderedSimulationResult.recordedSpikes[i].neuronId, simulationResult.recordedSpikes[i].neuronId);
+        ASSERT_EQ(reorderedSimulationResult.recordedSpikes[i].time, simulationResult.recordedSpikes[i].time);
+    }
+
+    ASSERT_EQ(reorderedSimulationResult.finalSynapseInfos.size(), simulationResult.finalSynapseInfos.size());
+
+    for (SizeType i = 0; i < simulationResult.finalSynapseInfos.size(); ++i) {
+        ASSERT_EQ(reorderedSimulationResult.finalSynapseInfos[i].postSynapticNeuronId, simulationResult.finalSynapseInfos[i].postSynapticNeuronId);
+        ASSERT_EQ(reorderedSimulationResult.finalSynapseInfos[i].weight, simulationResult.finalSynapseInfos[i].weight);
+    }
+}
+
+TEST(PopulationGeneratorTests, P1000GenerationIndependentOfSharedRandomEngine) {
+    auto params = getTemplateParams();
+    (*params)["simulation"]["populationGenerator"] = "p1000";
+
+    RandomEngineType randomEngine;
+    auto population = PopulationGeneratorFactory::createFromParams(*params, randomEngine)->generatePopulation();
+
+    RandomEngineType advancedRandomEngine;
+    advancedRandomEngine.discard(12345);
+    auto otherPopulation = PopulationGeneratorFactory::createFromParams(*params, advancedRandomEngine)->generatePopulation();
+
+    for (SizeType neuronId = 0; neuronId < population->getPopulationSize(); ++neuronId) {
+        const auto& neuron = population->getNeuronById(neuronId);
+        const auto& otherNeuron = otherPopulation->getNeuronById(neuronId);
+
+        ASSERT_EQ(
+                std::distance(otherNeuron.cbeginOutboundSynapses(), otherNeuron.cendOutboundSynapses()),
+                std::distance(neuron.cbeginOutboundSynapses(), neuron.cendOutboundSynapses()));
+
+        for (auto synIt = neuron.cbeginOutboundSynapses(), otherSynIt = otherNeuron.cbeginOutboundSynapses();
+             synIt != neuron.cendOutboundSynapses(); ++synIt, ++otherSynIt) {
+            ASSERT_EQ((*otherSynIt)->postSynapticNeuron->getNeuronId(), (*synIt)->postSynapticNeuron->getNeuronId());
+            ASSERT_EQ((*otherSynIt)->conductionDelay, (*synIt)->conductionDelay);
+        }
+    }
+}
@@ -124,4 +124,13 @@ auto getTemplateParams() {
     return std::make_shared<ParamsType>(nlohmann::json::parse(jsonString));
 }
 
+// the p1000 population, driven by non-coherent stimulation strong enough to make it fire throughout
+auto getStimulatedP1000Params() {
+    auto params = getTemplateParams();
+    (*params)["simulation"]["populationGenerator"] = "p1000";
+    (*params)["nonCoherentStimulator"]["rate"] = 4.0;
+    (*params)["nonCoherentStimulator"]["epsp"] = 3.5;
+    return params;
+}
+
 }
@@ -0,0 +1,103 @@
+#include <Aliases.hpp>
+#include <core/TimeWindowedRingBuffer.hpp>
+#include "gtest/gtest.h"
+#include <vector>
+
+using namespace soft_npu;
+
+struct TimedElement {
+    TimedElement() = default;
+    TimedElement(int value, TimeType time) : value(value), time(time) {}
+
+    int value;
+    TimeType time;
+};
+
+std::vector<int> getValues(const TimeWindowedRingBuffer<TimedElement>& buffer) {
+    std::vector<int> rv;
+    buffer.forEach([&rv](const TimedElement& element) {
+        rv.push_back(element.value);
+    });
+    return rv;
+}
+
+auto makeIsExpired(TimeType now, TimeType window) {
+    return [now, window](const TimedElement& element) {
+        return now - element.time >= window;
+    };
+}
+
+TEST(TimeWindowedRingBufferTest, EvictsExpiredEntries) {
+    TimeWindowedRingBuffer<TimedElement> buffer(4);
+
+    buffer.evictAndEmplace(makeIsExpired(0, 3), 0, 0);
+    buffer.evictAndEmplace(makeIsExpired(1, 3), 1, 1);
+    buffer.evictAndEmplace(makeIsExpired(2, 3), 2, 2);
+    ASSERT_EQ(getValues(buffer), (std::vector<int>{0, 1, 2}));
+
+    buffer.evictAndEmplace(makeIsExpired(4, 3), 4, 4);
+    ASSERT_EQ(getValues(buffer), (std::vector<int>{2, 4}));
+
+    buffer.evictExpired(makeIsExpired(10, 3));
+    ASSERT_EQ(buffer.size(), 0);
+    ASSERT_EQ(buffer.capacity(), 4);
+}
+
+TEST(TimeWindowedRingBufferTest, CapacityBoundedByLiveWindow) {
+    TimeWindowedRingBuffer<TimedElement> buffer(4);
+
+    for (int i = 0; i < 1000; ++i) {
+        buffer.evictAndEmplace(makeIsExpired(i, 3), i, i);
+        ASSERT_LE(buffer.size(), 3);
+    }
+
+    ASSERT_EQ(buffer.capacity(), 4);
+    ASSERT_EQ(getValues(buffer), (std::vector<int>{997, 998, 999}));
+}
+
+TEST(TimeWindowedRingBufferTest, GrowsWhenWindowDoesNotFit) {
+    TimeWindowedRingBuffer<TimedElement> buffer(2);
+
+    for (int i = 0; i < 5; ++i) {
+        buffer.evictAndEmplace(makeIsExpired(0, 3), i, 0);
+    }
+
+    ASSERT_EQ(buffer.capacity(), 8);
+    ASSERT_EQ(getValues(buffer), (std::vector<int>{0, 1, 2, 3, 4}));
+
+    buffer.clear();
+    ASSERT_EQ(buffer.size(), 0);
+
+    buffer.evictAndEmplace(makeIsExpired(0, 3), 5, 0);
+    ASSERT_EQ(getValues(buffer), (std::vector<int>{5}));
+}
+
+TEST(TimeWindowedRingBufferTest, WrapAround) {
+    TimeWindowedRingBuffer<TimedElement> buffer(4);
+
+    for (int i = 0; i < 6; ++i) {
+        buffer.evictAndEmplace(makeIsExpired(i, 4), i, i);
+    }
+
+    buffer.evictAndEmplace(makeIsExpired(6, 2), 6, 6);
+    ASSERT_EQ(getValues(buffer), (std::vector<int>{5, 6}));
+
+    buffer.evictAndEmplace(makeIsExpired(6, 2), 7, 6);
+    buffer.evictAndEmplace(makeIsExpired(6, 2), 8, 6);
+    buffer.evictAndEmplace(makeIsExpired(6, 2), 9, 6);
+    ASSERT_EQ(buffer.capacity(), 8);
+    ASSERT_EQ(getValues(buffer), (std::vector<int>{5, 6, 7, 8, 9}));
+}
+
+TEST(TimeWindowedRingBufferTest, AllocatesOnFirstInsertion) {
+    TimeWindowedRingBuffer<TimedElement> buffer;
+    ASSERT_EQ(buffer.capacity(), 0);
+
+    buffer.evictExpired(makeIsExpired(0, 3));
+    ASSERT_EQ(getValues(buffer), (std::vector<int>{}));
+
+    buffer.evictAndEmplace(makeIsExpired(0, 3), 0, 0);
+    buffer.evictAndEmplace(makeIsExpired(0, 3), 1, 0);
+    ASSERT_EQ(buffer.capacity(), 2);
+    ASSERT_EQ(getValues(buffer), (std::vector<int>{0, 1}));
+}
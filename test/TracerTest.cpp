@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <core/StaticInputSimulation.hpp>
+#include <util/FileUtil.hpp>
+#include <util/Tracer.hpp>
+#include <TestUtil.hpp>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace soft_npu;
+
+static ParamsType readTrace(const std::string& path) {
+    auto trace = ParamsType::parse(FileUtil::getFileContent(path));
+    std::remove(path.c_str());
+    return trace;
+}
+
+static SizeType countEvents(const ParamsType& trace, const std::string& name) {
+    SizeType count = 0;
+
+    for (const auto& event : trace["traceEvents"]) {
+        if (event["ph"] == "X" && event["name"] == name) {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+TEST(TracerTest, SpansAreExported) {
+    {
+        ScopedTraceSpan ignoredSpan("ignored", "test");
+    }
+
+    ASSERT_TRUE(Tracer::start(0));
+
+    {
+        ScopedTraceSpan outerSpan("outer", "test");
+        ScopedTraceSpan innerSpan("inner", "test", 7);
+    }
+
+    Tracer::finish("tracerTest.json");
+    auto trace = readTrace("tracerTest.json");
+
+    ASSERT_FALSE(Tracer::isEnabled());
+    ASSERT_EQ(countEvents(trace, "outer"), 1);
+    ASSERT_EQ(countEvents(trace, "inner"), 1);
+    ASSERT_EQ(countEvents(trace, "ignored"), 0);
+
+    for (const auto& event : trace["traceEvents"]) {
+        if (event["name"] == "inner") {
+            ASSERT_EQ(event["args"]["id"], 7);
+            ASSERT_EQ(event["cat"], "test");
+            ASSERT_GE(event["dur"].get<double>(), 0);
+        }
+    }
+}
+
+TEST(TracerTest, EventsBeyondBoundAreDropped) {
+    ASSERT_TRUE(Tracer::start(0, 3));
+
+    for (int i = 0; i < 5; ++i) {
+        ScopedTraceSpan span("span", "test");
+    }
+
+    Tracer::finish("tracerTest.json");
+    auto trace = readTrace("tracerTest.json");
+
+    ASSERT_EQ(countEvents(trace, "span"), 3);
+    ASSERT_EQ(trace["otherData"]["numDroppedEvents"], "2");
+}
+
+TEST(TracerTest, RunningTraceIsNotRestarted) {
+    ASSERT_TRUE(Tracer::start(0));
+
+    {
+        ScopedTraceSpan span("first", "test");
+    }
+
+    {
+        TraceSession nestedTraceSession("nestedTracerTest.json", 0);
+        ScopedTraceSpan span("second", "test");
+        ASSERT_FALSE(nestedTraceSession.finish());
+    }
+
+    ASSERT_TRUE(Tracer::isEnabled());
+    ASSERT_FALSE(Tracer::start(0));
+
+    Tracer::finish("tracerTest.json");
+    auto trace = readTrace("tracerTest.json");
+
+    ASSERT_EQ(countEvents(trace, "first"), 1);
+    ASSERT_EQ(countEvents(trace, "second"), 1);
+
+    {
+        TraceSession traceSession("tracerTest.json", 0);
+    }
+
+    // released by the destructor
+    ASSERT_FALSE(Tracer::isEnabled());
+    ASSERT_TRUE(Tracer::start(0));
+    Tracer::stop();
+}
+
+TEST(TracerTest, ConcurrentRecordersSurviveRestart) {
+    std::atomic<bool> isDone(false);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&isDone] {
+            while (!isDone.load()) {
+                ScopedTraceSpan span("concurrent", "test");
+            }
+        });
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(Tracer::start(0, 1000));
+        Tracer::stop();
+    }
+
+    isDone.store(true);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+TEST(TracerTest, SimulationCyclesAreSampled) {
+    auto params = getTemplateParams();
+    (*params)["simulation"]["populationGenerator"] = "p1000";
+    (*params)["simulation"]["untilTime"] = 0.1;
+    (*params)["simulation"]["traceFile"] = "tracerTest.json";
+    (*params)["simulation"]["traceCycleSampleInterval"] = 10;
+
+    StaticInputSimulation simulation(params);
+    simulation.run();
+
+    ASSERT_FALSE(Tracer::isEnabled());
+
+    auto trace = readTrace("tracerTest.json");
+
+    ASSERT_EQ(countEvents(trace, "population generation"), 1);
+    ASSERT_EQ(countEvents(trace, "cycles"), 1);
+
+    // every 10th of the 1000 cycles of 0.1 ms
+    auto numTracedCycles = countEvents(trace, "threshold evaluation");
+    ASSERT_GE(numTracedCycles, 100);
+    ASSERT_LE(numTracedCycles, 101);
+}
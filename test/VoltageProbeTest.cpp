@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <core/StaticInputSimulation.hpp>
+#include <core/VoltageProbe.hpp>
+#include <genesis/PopulationGeneratorFactory.hpp>
+#include <TestUtil.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+using namespace soft_npu;
+
+static std::shared_ptr<ParamsType> getP1000Params() {
+    auto params = getStimulatedP1000Params();
+    (*params)["simulation"]["untilTime"] = 0.1;
+    return params;
+}
+
+static std::vector<char> readFile(const std::string& path) {
+    std::ifstream is(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+}
+
+TEST(VoltageProbeTest, MatchesScheduledVoltageRecordings) {
+    auto params = getP1000Params();
+    TimeType dt = (*params)["cycleController"]["dt"];
+
+    StaticInputSimulation simulation(params);
+    simulation.probeVoltages({0, 5, 900}, 1e-3);
+
+    for (SizeType cycle = 0; cycle < 1000; cycle += 10) {
+        simulation.recordVoltage(5, cycle * dt);
+    }
+
+    auto simulationResult = simulation.run();
+    const auto& voltageSamples = simulationResult.voltageSamples;
+
+    ASSERT_EQ(voltageSamples.neuronIds, std::vector<SizeType>({0, 5, 900}));
+    ASSERT_EQ(voltageSamples.times.size(), 100);
+    ASSERT_EQ(voltageSamples.voltages.size(), 300);
+    ASSERT_EQ(simulationResult.voltageRecordings.size(), 100);
+
+    bool isAnyVoltageNonZero = false;
+
+    for (SizeType row = 0; row < 100; ++row) {
+        const auto& voltageRecording = simulationResult.voltageRecordings[row];
+        ASSERT_EQ(voltageSamples.times[row], voltageRecording.time);
+        ASSERT_EQ(voltageSamples.getVoltage(row, 1), voltageRecording.voltage);
+        isAnyVoltageNonZero = isAnyVoltageNonZero || voltageRecording.voltage != 0;
+    }
+
+    ASSERT_TRUE(isAnyVoltageNonZero);
+}
+
+TEST(VoltageProbeTest, FlushFileMatchesInMemorySamples) {
+    auto params = getP1000Params();
+    std::string flushFilePath = "voltageProbeTest.bin";
+
+    StaticInputSimulation inMemorySimulation(params);
+    inMemorySimulation.probeVoltages({3, 4}, 5e-4);
+    auto expectedSamples = inMemorySimulation.run().voltageSamples;
+
+    (*params)["voltageProbe"] = {{"neuronIds", {3, 4}}, {"sampleInterval", 5e-4}, {"flushFile", flushFilePath}};
+    StaticInputSimulation flushingSimulation(params);
+    auto simulationResult = flushingSimulation.run();
+
+    ASSERT_TRUE(simulationResult.voltageSamples.times.empty());
+
+    auto content = readFile(flushFilePath);
+    std::remove(flushFilePath.c_str());
+
+    uint64_t numNeurons;
+    uint32_t valueSize;
+    uint64_t neuronIds[2];
+    std::memcpy(&numNeurons, content.data() + 8, sizeof(numNeurons));
+    std::memcpy(&valueSize, content.data() + 16, sizeof(valueSize));
+    std::memcpy(neuronIds, content.data() + 24, sizeof(neuronIds));
+
+    ASSERT_EQ(std::string(content.data(), 8), "SNPVOLT1");
+    ASSERT_EQ(numNeurons, 2);
+    ASSERT_EQ(valueSize, sizeof(ValueType));
+    ASSERT_EQ(neuronIds[1], 4);
+
+    SizeType headerSize = 40;
+    SizeType rowSize = sizeof(double) + 2 * sizeof(ValueType);
+    ASSERT_EQ(content.size(), headerSize + expectedSamples.times.size() * rowSize);
+
+    for (SizeType row = 0; row < expectedSamples.times.size(); ++row) {
+        double time;
+        ValueType voltages[2];
+        std::memcpy(&time, content.data() + headerSize + row * rowSize, sizeof(time));
+        std::memcpy(voltages, content.data() + headerSize + row * rowSize + sizeof(time), sizeof(voltages));
+
+        ASSERT_EQ(time, expectedSamples.times[row]);
+        ASSERT_EQ(voltages[0], expectedSamples.getVoltage(row, 0));
+        ASSERT_EQ(voltages[1], expectedSamples.getVoltage(row, 1));
+    }
+}
+
+TEST(VoltageProbeTest, FlushesFullBuffers) {
+    auto params = getTemplateParams();
+    RandomEngineType randomEngine(0);
+    auto population = PopulationGeneratorFactory::createFromParams(*params, randomEngine)->generatePopulation();
+    std::string flushFilePath = "voltageProbeTest.bin";
+
+    VoltageProbe voltageProbe(*population, {0}, 2, 3, flushFilePath);
+    ASSERT_TRUE(voltageProbe.isEnabled());
+
+    for (SizeType cycle = 0; cycle < 14; ++cycle) {
+        voltageProbe.onCycleEnd(cycle, cycle * 1e-4);
+    }
+
+    ASSERT_EQ(voltageProbe.getNumFlushedRows(), 6);
+
+    auto voltageSamples = voltageProbe.finish();
+    ASSERT_EQ(voltageProbe.getNumFlushedRows(), 7);
+    ASSERT_TRUE(voltageSamples.times.empty());
+
+    auto content = readFile(flushFilePath);
+    std::remove(flushFilePath.c_str());
+    ASSERT_EQ(content.size(), 32 + 7 * (sizeof(double) + sizeof(ValueType)));
+}
+
+TEST(VoltageProbeTest, DisabledByDefault) {
+    VoltageProbe voltageProbe;
+    voltageProbe.onCycleEnd(0, 0);
+
+    ASSERT_FALSE(voltageProbe.isEnabled());
+    ASSERT_TRUE(voltageProbe.finish().times.empty());
+}
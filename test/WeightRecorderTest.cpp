@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <core/StaticInputSimulation.hpp>
+#include <TestUtil.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+using namespace soft_npu;
+
+using WeightBitsType = std::conditional_t<sizeof(ValueType) == 4, uint32_t, uint64_t>;
+
+struct WeightRecording {
+    std::vector<std::pair<SizeType, SizeType>> preAndPostSynapticNeuronIds;
+    std::vector<TimeType> snapshotTimes;
+    std::vector<SizeType> numChangesBySnapshot;
+    std::vector<ValueType> lastSnapshotWeights;
+};
+
+class RecordingReader {
+public:
+    explicit RecordingReader(const std::string& path) {
+        std::ifstream is(path, std::ios::binary);
+        bytes = {std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+    }
+
+    uint64_t readVarint() {
+        uint64_t value = 0;
+
+        for (unsigned shift = 0; ; shift += 7) {
+            auto byte = static_cast<uint8_t>(bytes.at(position++));
+            value |= static_cast<uint64_t>(byte & 0x7fu) << shift;
+
+            if ((byte & 0x80u) == 0) {
+                return value;
+            }
+        }
+    }
+
+    template<typename T>
+    T read() {
+        T value;
+        std::memcpy(&value, bytes.data() + position, sizeof(T));
+        position += sizeof(T);
+        return value;
+    }
+
+    std::string readMagic() {
+        position += 8;
+        return std::string(bytes.data(), 8);
+    }
+
+    bool isAtEnd() const noexcept {
+        return position == bytes.size();
+    }
+
+private:
+    std::vector<char> bytes;
+    SizeType position = 0;
+};
+
+static WeightRecording readWeightRecording(const std::string& path) {
+    RecordingReader reader(path);
+    WeightRecording weightRecording;
+
+    EXPECT_EQ(reader.readMagic(), "SNPWGHT1");
+    EXPECT_EQ(reader.read<uint32_t>(), sizeof(ValueType));
+    reader.read<uint32_t>();
+
+    auto numSynapses = reader.readVarint();
+    SizeType preSynapticNeuronId = 0;
+
+    for (SizeType i = 0; i < numSynapses; ++i) {
+        preSynapticNeuronId += reader.readVarint();
+        weightRecording.preAndPostSynapticNeuronIds.emplace_back(preSynapticNeuronId, reader.readVarint());
+    }
+
+    std::vector<WeightBitsType> weightBits(numSynapses);
+
+    while (!reader.isAtEnd()) {
+        weightRecording.snapshotTimes.push_back(reader.read<double>());
+        auto numChanges = reader.readVarint();
+        weightRecording.numChangesBySnapshot.push_back(numChanges);
+
+        int64_t index = -1;
+        for (SizeType i = 0; i < numChanges; ++i) {
+            index += reader.readVarint();
+            weightBits[index] ^= reader.readVarint();
+        }
+    }
+
+    for (auto bits : weightBits) {
+        ValueType weight;
+        std::memcpy(&weight, &bits, sizeof(weight));
+        weightRecording.lastSnapshotWeights.push_back(weight);
+    }
+
+    return weightRecording;
+}
+
+TEST(WeightRecorderTest, SnapshotsReconstructFinalWeights) {
+    auto params = getStimulatedP1000Params();
+    // the last cycle starts at 0.95, which is the last sample time
+    (*params)["simulation"]["untilTime"] = 0.95005;
+    (*params)["weightRecorder"] = {{"sampleInterval", 0.05}, {"file", "weightRecorderTest.snpw"}};
+
+    StaticInputSimulation simulation(params);
+    auto simulationResult = simulation.run();
+
+    auto weightRecording = readWeightRecording("weightRecorderTest.snpw");
+    std::remove("weightRecorderTest.snpw");
+
+    std::vector<SynapseInfo> excitatorySynapseInfos;
+    for (const auto& synapseInfo : simulationResult.finalSynapseInfos) {
+        if (!synapseInfo.isInhibitory) {
+            excitatorySynapseInfos.push_back(synapseInfo);
+        }
+    }
+
+    ASSERT_EQ(weightRecording.preAndPostSynapticNeuronIds.size(), excitatorySynapseInfos.size());
+    ASSERT_EQ(weightRecording.snapshotTimes.size(), 20);
+    ASSERT_DOUBLE_EQ(weightRecording.snapshotTimes.back(), 0.95);
+
+    // every weight is nonzero at first, later snapshots hold the changes only
+    ASSERT_EQ(weightRecording.numChangesBySnapshot.front(), excitatorySynapseInfos.size());
+    auto maxNumLaterChanges = *std::max_element(
+            weightRecording.numChangesBySnapshot.cbegin() + 1,
+            weightRecording.numChangesBySnapshot.cend());
+    ASSERT_GT(maxNumLaterChanges, 0);
+    ASSERT_LT(maxNumLaterChanges, excitatorySynapseInfos.size());
+
+    for (SizeType i = 0; i < excitatorySynapseInfos.size(); ++i) {
+        ASSERT_EQ(weightRecording.preAndPostSynapticNeuronIds[i].first, excitatorySynapseInfos[i].preSynapticNeuronId);
+        ASSERT_EQ(weightRecording.preAndPostSynapticNeuronIds[i].second, excitatorySynapseInfos[i].postSynapticNeuronId);
+        ASSERT_EQ(weightRecording.lastSnapshotWeights[i], excitatorySynapseInfos[i].weight);
+    }
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <core/StaticInputSimulation.hpp>
+#include <core/CycleController.hpp>
+#include <core/Recordings.hpp>
+#include <core/SynapticTransmissionStats.hpp>
 #include <vector>
 #include <cmath>
 #include <TestUtil.hpp>
@@ -531,6 +534,167 @@ TEST(BasicIntegrationTests, DifferentBufferSizes) {
     ASSERT_EQ(simulation1Result.numEventsProcessed, simulation2Result.numEventsProcessed);
 }
 
+TEST(BasicIntegrationTests, PrecomputedNoiseSchedule) {
+    auto params = getTemplateParams();
+
+    (*params)["simulation"]["populationGenerator"] = "p1000";
+    (*params)["simulation"]["untilTime"] = 1.0;
+    (*params)["nonCoherentStimulator"]["rate"] = 10;
+    (*params)["populationGenerators"]["p1000"]["inhibitorySynapseWeight"] = 0.4;
+    (*params)["populationGenerators"]["p1000"]["excitatorySynapseInitialWeight"] = 0.1;
+
+    StaticInputSimulation simulation1(params);
+    auto simulation1Result = simulation1.run();
+
+    (*params)["nonCoherentStimulator"]["precomputeSchedule"] = true;
+
+    StaticInputSimulation simulation2(params);
+    auto simulation2Result = simulation2.run();
+
+    ASSERT_FALSE(simulation1Result.recordedSpikes.empty());
+    ASSERT_EQ(simulation1Result.recordedSpikes.size(), simulation2Result.recordedSpikes.size());
+
+    for (SizeType i = 0; i < simulation1Result.recordedSpikes.size(); ++i) {
+        const auto& spikeInfo1 = simulation1Result.recordedSpikes[i];
+        const auto& spikeInfo2 = simulation2Result.recordedSpikes[i];
+
+        ASSERT_FLOAT_EQ(spikeInfo1.time, spikeInfo2.time);
+        ASSERT_EQ(spikeInfo1.neuronId, spikeInfo2.neuronId);
+    }
+
+    ASSERT_EQ(simulation1Result.numEventsProcessed, simulation2Result.numEventsProcessed);
+}
+
+TEST(BasicIntegrationTests, BatchedSpikeListener) {
+    auto params = getTemplateParams();
+    (*params)["simulation"]["populationGenerator"] = "p1000";
+    (*params)["nonCoherentStimulator"]["rate"] = 10;
+
+    RandomEngineType randomEngine;
+    auto population = PopulationGeneratorFactory::createFromParams(*params, randomEngine)->generatePopulation();
+    SynapticTransmissionStats synapticTransmissionStats;
+    CycleController controller(*params, *population, true, {}, synapticTransmissionStats);
+
+    std::vector<NeuronSpikeInfo> listenedSpikes;
+    SizeType numListenerCalls = 0;
+
+    auto spikeListenerId = population->addSpikeListener([&](
+            const CycleContext& cycleContext, const std::vector<SizeType>& spikingNeuronIds) {
+        ASSERT_FALSE(spikingNeuronIds.empty());
+        ASSERT_EQ(spikingNeuronIds, controller.getCycleOutputBuffer().getSpikingNeuronIds());
+        ++ numListenerCalls;
+
+        for (auto neuronId : spikingNeuronIds) {
+            listenedSpikes.emplace_back(cycleContext.time, neuronId);
+        }
+    });
+
+    for (SizeType i = 0; i < 1000; ++i) {
+        controller.runCycle();
+    }
+
+    const auto& recordedSpikes = controller.getRecordings()->neuronSpikeRecordings;
+
+    ASSERT_FALSE(recordedSpikes.empty());
+    ASSERT_LT(numListenerCalls, recordedSpikes.size());
+    ASSERT_EQ(listenedSpikes.size(), recordedSpikes.size());
+
+    for (SizeType i = 0; i < recordedSpikes.size(); ++i) {
+        ASSERT_EQ(listenedSpikes[i].neuronId, recordedSpikes[i].neuronId);
+        ASSERT_FLOAT_EQ(listenedSpikes[i].time, recordedSpikes[i].time);
+    }
+
+    population->removeSpikeListener(spikeListenerId);
+    auto numListenedSpikes = listenedSpikes.size();
+
+    for (SizeType i = 0; i < 1000; ++i) {
+        controller.runCycle();
+    }
+
+    ASSERT_GT(controller.getRecordings()->neuronSpikeRecordings.size(), numListenedSpikes);
+    ASSERT_EQ(listenedSpikes.size(), numListenedSpikes);
+}
+
+TEST(BasicIntegrationTests, DeduplicatedThresholdEvaluation) {
+    auto params = getTemplateParams();
+
+    RandomEngineType randomEngine;
+    auto population = PopulationGeneratorFactory::createFromParams(*params, randomEngine)->generatePopulation();
+    SynapticTransmissionStats synapticTransmissionStats;
+    CycleController controller(*params, *population, true, {}, synapticTransmissionStats);
+
+    for (int i = 0; i < 5; ++i) {
+        controller.getCycleInputBuffer().addSpike(0);
+    }
+
+    controller.runCycle();
+
+    ASSERT_EQ(controller.getRecordings()->neuronSpikeRecordings.size(), 1);
+    ASSERT_EQ(controller.getLastCycleFiringThresholdEvalStats().numCandidates, 1);
+    ASSERT_EQ(controller.getLastCycleFiringThresholdEvalStats().numSpikes, 1);
+    ASSERT_EQ(controller.getNumEventsProcessed(), 6);
+
+    controller.getCycleInputBuffer().reset();
+    controller.runCycle();
+
+    ASSERT_EQ(controller.getLastCycleFiringThresholdEvalStats().numCandidates, 0);
+    ASSERT_EQ(controller.getTotalFiringThresholdEvalStats().numCandidates, 1);
+    ASSERT_EQ(controller.getTotalFiringThresholdEvalStats().numSpikes, 1);
+}
+
+TEST(BasicIntegrationTests, InferenceModeFreezesWeights) {
+    auto params = getTemplateParams();
+
+    (*params)["simulation"]["populationGenerator"] = "p1000";
+    (*params)["simulation"]["inferenceMode"] = true;
+    (*params)["nonCoherentStimulator"]["rate"] = 10;
+
+    StaticInputSimulation simulation(params);
+    auto simulationResult = simulation.run();
+
+    ASSERT_FALSE(simulationResult.recordedSpikes.empty());
+
+    for (const auto& synapseInfo : simulationResult.finalSynapseInfos) {
+        ASSERT_EQ(synapseInfo.weight, static_cast<ValueType>(synapseInfo.isInhibitory ? 0.3 : 0.1));
+    }
+}
+
+TEST(BasicIntegrationTests, InferenceModeMatchesNonLearningSimulation) {
+    auto params = getTemplateParams();
+
+    (*params)["simulation"]["populationGenerator"] = "p1000";
+    (*params)["nonCoherentStimulator"]["rate"] = 10;
+    (*params)["synapseParams"]["stdpScaleFactorPotentiation"] = 0.0;
+
+    StaticInputSimulation simulation1(params);
+    auto simulation1Result = simulation1.run();
+
+    (*params)["simulation"]["inferenceMode"] = true;
+
+    StaticInputSimulation simulation2(params);
+    auto simulation2Result = simulation2.run();
+
+    ASSERT_FALSE(simulation1Result.recordedSpikes.empty());
+    ASSERT_EQ(simulation1Result.recordedSpikes.size(), simulation2Result.recordedSpikes.size());
+
+    for (SizeType i = 0; i < simulation1Result.recordedSpikes.size(); ++i) {
+        ASSERT_FLOAT_EQ(simulation1Result.recordedSpikes[i].time, simulation2Result.recordedSpikes[i].time);
+        ASSERT_EQ(simulation1Result.recordedSpikes[i].neuronId, simulation2Result.recordedSpikes[i].neuronId);
+    }
+}
+
+TEST(BasicIntegrationTests, InferenceModeRejectsRewardDoses) {
+    auto params = getTemplateParams();
+
+    (*params)["simulation"]["populationGenerator"] = "p1000";
+    (*params)["simulation"]["inferenceMode"] = true;
+
+    StaticInputSimulation simulation(params);
+    simulation.setRewardDoses({{0.1, 1.0}});
+
+    ASSERT_THROW(simulation.run(), std::runtime_error);
+}
+
 TEST(BasicIntegrationTests, OneToManyChannelProjectorInput) {
     auto params = getTemplateParams();
 
@@ -671,3 +835,50 @@ TEST(BasicIntegrationTests, IPSPProcessedAfterSufficientEPSP) {
     ASSERT_EQ(simulationResult.recordedSpikes[0].neuronId, 0);
     ASSERT_EQ(simulationResult.recordedSpikes[1].neuronId, 1);
 }
+
+TEST(BasicIntegrationTests, PhaseWallTimes) {
+    auto params = getStimulatedP1000Params();
+
+    StaticInputSimulation simulation(params);
+    auto simulationResult = simulation.run();
+
+#ifdef SOFT_NPU_PHASE_TIMERS
+    ASSERT_EQ(simulationResult.phaseWallTimes.size(), static_cast<SizeType>(CyclePhase::numPhases));
+
+    double totalPhaseWallTime = 0;
+
+    for (const auto& phaseWallTime : simulationResult.phaseWallTimes) {
+        ASSERT_GE(phaseWallTime.wallTime, 0);
+        totalPhaseWallTime += phaseWallTime.wallTime;
+    }
+
+    ASSERT_GT(totalPhaseWallTime, 0);
+    ASSERT_LE(totalPhaseWallTime, simulationResult.wallTimeEventProcessor);
+#else
+    ASSERT_TRUE(simulationResult.phaseWallTimes.empty());
+#endif
+}
+
+TEST(BasicIntegrationTests, PhasePerfCounts) {
+    auto params = getStimulatedP1000Params();
+
+    StaticInputSimulation simulation(params);
+    auto simulationResult = simulation.run();
+
+#ifdef SOFT_NPU_PERF_COUNTERS
+    // counters may be unavailable, e.g. in virtual machines without a virtual PMU
+    if (!PerfCounterGroup().isAvailable()) {
+        ASSERT_TRUE(simulationResult.phasePerfCounts.empty());
+        return;
+    }
+
+    ASSERT_EQ(simulationResult.phasePerfCounts.size(), static_cast<SizeType>(CyclePhase::numPhases) + 1);
+    ASSERT_EQ(simulationResult.phasePerfCounts.front().phaseName, "population generation");
+
+    for (const auto& phasePerfCounts : simulationResult.phasePerfCounts) {
+        ASSERT_GT(phasePerfCounts.counts.instructions, 0);
+    }
+#else
+    ASSERT_TRUE(simulationResult.phasePerfCounts.empty());
+#endif
+}
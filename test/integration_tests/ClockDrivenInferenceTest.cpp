@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include <core/StaticInputSimulation.hpp>
+#include <core/CycleController.hpp>
+#include <TestUtil.hpp>
+
+using namespace soft_npu;
+
+auto makeInferenceParams(ValueType minEventDensity) {
+    auto params = getStimulatedP1000Params();
+
+    (*params)["simulation"]["untilTime"] = 2.0;
+    (*params)["simulation"]["inferenceMode"] = true;
+    (*params)["populationGenerators"]["p1000"]["inhibitorySynapseWeight"] = 0.5;
+    (*params)["populationGenerators"]["p1000"]["excitatorySynapseInitialWeight"] = 0.2;
+
+    if (minEventDensity >= 0) {
+        (*params)["clockDrivenInference"]["minEventDensity"] = minEventDensity;
+    }
+
+    return params;
+}
+
+class ClockDrivenSimulation : public StaticInputSimulation {
+public:
+    using StaticInputSimulation::StaticInputSimulation;
+
+    void runController(
+            CycleController& controller,
+            Population& population,
+            TimeType simulationTime,
+            SynapticTransmissionStats& synapticTransmissionStats) override {
+        StaticInputSimulation::runController(controller, population, simulationTime, synapticTransmissionStats);
+
+        numCycles = static_cast<SizeType>(std::round(controller.getTime() / controller.getTimeIncrement()));
+        auto engine = controller.getClockDrivenInferenceEngine();
+        numClockDrivenCycles = engine != nullptr ? engine->getNumClockDrivenCycles() : 0;
+    }
+
+    SizeType numCycles = 0;
+    SizeType numClockDrivenCycles = 0;
+};
+
+// input spikes on the sensory channels
+auto runWithInputs(std::shared_ptr<ParamsType> params) {
+    auto simulation = std::make_unique<ClockDrivenSimulation>(params);
+
+    std::deque<ChannelSpikeInfo> spikeTrains;
+
+    for (SizeType i = 0; i < 200; ++i) {
+        spikeTrains.emplace_back(i * 7e-3, (i * 37) % 800);
+    }
+
+    simulation->setSpikeTrains(std::move(spikeTrains));
+
+    auto simulationResult = simulation->run();
+    return std::make_pair(std::move(simulationResult), std::move(simulation));
+}
+
+// without clock-driven cycles, the arithmetic is that of the double engine
+TEST(ClockDrivenInferenceTest, EventDrivenMatchesDoubleEngine) {
+    auto [referenceResult, referenceSimulation] = runWithInputs(makeInferenceParams(-1));
+    auto [simulationResult, simulation] = runWithInputs(makeInferenceParams(1e9));
+
+    ASSERT_EQ(simulation->numClockDrivenCycles, 0);
+    ASSERT_FALSE(referenceResult.recordedSpikes.empty());
+    ASSERT_EQ(simulationResult.recordedSpikes.size(), referenceResult.recordedSpikes.size());
+
+    for (SizeType i = 0; i < referenceResult.recordedSpikes.size(); ++i) {
+        ASSERT_EQ(simulationResult.recordedSpikes[i].time, referenceResult.recordedSpikes[i].time);
+        ASSERT_EQ(simulationResult.recordedSpikes[i].neuronId, referenceResult.recordedSpikes[i].neuronId);
+    }
+
+    ASSERT_EQ(simulationResult.numEventsProcessed, referenceResult.numEventsProcessed);
+}
+
+TEST(ClockDrivenInferenceTest, ClockDrivenCloseToDoubleEngine) {
+    auto [referenceResult, referenceSimulation] = runWithInputs(makeInferenceParams(-1));
+    auto [simulationResult, simulation] = runWithInputs(makeInferenceParams(0));
+
+    ASSERT_EQ(simulation->numClockDrivenCycles, simulation->numCycles);
+    ASSERT_GT(referenceResult.numExcitatorySpikes, 0);
+    ASSERT_GT(referenceResult.numInhibitorySpikes, 0);
+
+    ASSERT_NEAR(simulationResult.numExcitatorySpikes, referenceResult.numExcitatorySpikes, 1e-2 * referenceResult.numExcitatorySpikes);
+    ASSERT_NEAR(simulationResult.numInhibitorySpikes, referenceResult.numInhibitorySpikes, 1e-2 * referenceResult.numInhibitorySpikes);
+}
+
+// with about one transmission event per neuron and cycle, a part of the cycles is clock-driven
+TEST(ClockDrivenInferenceTest, SwitchesPerCycle) {
+    auto [referenceResult, referenceSimulation] = runWithInputs(makeInferenceParams(-1));
+    auto [simulationResult, simulation] = runWithInputs(makeInferenceParams(1));
+
+    ASSERT_GT(simulation->numClockDrivenCycles, 0);
+    ASSERT_LT(simulation->numClockDrivenCycles, simulation->numCycles);
+
+    ASSERT_NEAR(simulationResult.numExcitatorySpikes, referenceResult.numExcitatorySpikes, 1e-2 * referenceResult.numExcitatorySpikes);
+    ASSERT_NEAR(simulationResult.numInhibitorySpikes, referenceResult.numInhibitorySpikes, 1e-2 * referenceResult.numInhibitorySpikes);
+}
+
+TEST(ClockDrivenInferenceTest, Deterministic) {
+    auto [simulationResult0, simulation0] = runWithInputs(makeInferenceParams(1));
+    auto [simulationResult1, simulation1] = runWithInputs(makeInferenceParams(1));
+
+    ASSERT_EQ(simulationResult0.recordedSpikes.size(), simulationResult1.recordedSpikes.size());
+
+    for (SizeType i = 0; i < simulationResult0.recordedSpikes.size(); ++i) {
+        ASSERT_EQ(simulationResult0.recordedSpikes[i].time, simulationResult1.recordedSpikes[i].time);
+        ASSERT_EQ(simulationResult0.recordedSpikes[i].neuronId, simulationResult1.recordedSpikes[i].neuronId);
+    }
+}
+
+TEST(ClockDrivenInferenceTest, RequiresInferenceMode) {
+    auto params = makeInferenceParams(0);
+    (*params)["simulation"]["inferenceMode"] = false;
+
+    ASSERT_THROW(StaticInputSimulation(params).run(), std::runtime_error);
+}
+
+TEST(ClockDrivenInferenceTest, InvalidMinEventDensity) {
+    auto params = makeInferenceParams(0);
+    (*params)["clockDrivenInference"]["minEventDensity"] = -1;
+
+    ASSERT_THROW(StaticInputSimulation(params).run(), std::runtime_error);
+}
+
+TEST(ClockDrivenInferenceTest, NotCombinedWithQuantizedInference) {
+    auto params = makeInferenceParams(0);
+    (*params)["quantizedInference"]["weightBits"] = 16;
+
+    ASSERT_THROW(StaticInputSimulation(params).run(), std::runtime_error);
+}
+
+TEST(ClockDrivenInferenceTest, VoltagesNotSupported) {
+    StaticInputSimulation recordingSimulation(makeInferenceParams(0));
+    recordingSimulation.recordVoltage(0, 0.5);
+    ASSERT_THROW(recordingSimulation.run(), std::runtime_error);
+
+    StaticInputSimulation probingSimulation(makeInferenceParams(0));
+    probingSimulation.probeVoltages({0}, 1e-3);
+    ASSERT_THROW(probingSimulation.run(), std::runtime_error);
+}
+
+TEST(ClockDrivenInferenceTest, PartitionsNotSupported) {
+    auto params = makeInferenceParams(0);
+    (*params)["simulation"]["numPartitions"] = 2;
+
+    ASSERT_THROW(StaticInputSimulation simulation(params), std::runtime_error);
+}
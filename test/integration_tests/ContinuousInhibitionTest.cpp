@@ -2,6 +2,8 @@
 #include <Aliases.hpp>
 #include <core/StaticInputSimulation.hpp>
 #include <TestUtil.hpp>
+#include <genesis/PopulationGeneratorFactory.hpp>
+#include <neuro/Population.hpp>
 
 using namespace soft_npu;
 
@@ -94,3 +96,94 @@ TEST (ContinuousInhibitionTest, SpikeDespiteContinuousInhibition) {
     ASSERT_EQ(simulationResult.recordedSpikes[0].neuronId, 0);
     ASSERT_FLOAT_EQ(simulationResult.recordedSpikes[0].time, 10e-3);
 }
+
+auto makeSharedContinuousInhibitionTestTemplateParams() {
+    auto params = makeContinuousInhibitionTestTemplateParams();
+
+    auto populationJson = R"(
+{
+    "neurons": [
+        {
+            "neuronId": 0,
+            "neuronParamsName": "excitatory",
+            "continuousInhibitionSourceNeuronIds": [1]
+        },
+        {
+            "neuronId": 1,
+            "neuronParamsName": "continuousInhibitionSource"
+        },
+        {
+            "neuronId": 2,
+            "neuronParamsName": "excitatory",
+            "continuousInhibitionSourceNeuronIds": [1]
+        },
+        {
+            "neuronId": 3,
+            "neuronParamsName": "excitatory",
+            "continuousInhibitionSourceNeuronIds": [1, 4]
+        },
+        {
+            "neuronId": 4,
+            "neuronParamsName": "continuousInhibitionSource"
+        }
+    ],
+    "synapses": []
+}
+)"_json;
+
+    (*params)["populationGenerators"]["pDetailedParams"] = populationJson;
+
+    return params;
+}
+
+TEST (ContinuousInhibitionTest, AggregateSharedByIdenticalSources) {
+    auto params = makeSharedContinuousInhibitionTestTemplateParams();
+    RandomEngineType randomEngine;
+    auto population = PopulationGeneratorFactory::createFromParams(*params, randomEngine)->generatePopulation();
+
+    population->bindContinuousInhibitions();
+
+    ASSERT_NE(population->getNeuronById(0).getContinuousInhibition(), nullptr);
+    ASSERT_EQ(population->getNeuronById(0).getContinuousInhibition(), population->getNeuronById(2).getContinuousInhibition());
+    ASSERT_NE(population->getNeuronById(3).getContinuousInhibition(), nullptr);
+    ASSERT_NE(population->getNeuronById(3).getContinuousInhibition(), population->getNeuronById(0).getContinuousInhibition());
+    ASSERT_EQ(population->getNeuronById(1).getContinuousInhibition(), nullptr);
+    ASSERT_EQ(population->getNeuronById(4).getContinuousInhibition(), nullptr);
+}
+
+TEST (ContinuousInhibitionTest, SharedInhibitionPreventsSpikes) {
+    StaticInputSimulation simulation(makeSharedContinuousInhibitionTestTemplateParams());
+
+    simulation.setSpikeTrains({
+        {2e-3, 1},
+        {10e-3, 0},
+        {10e-3, 0},
+        {10e-3, 2},
+        {10e-3, 2}
+    });
+
+    auto simulationResult = simulation.run();
+
+    ASSERT_TRUE(simulationResult.recordedSpikes.empty());
+}
+
+TEST (ContinuousInhibitionTest, SpikesDespiteSharedInhibition) {
+    StaticInputSimulation simulation(makeSharedContinuousInhibitionTestTemplateParams());
+
+    simulation.setSpikeTrains({
+        {9e-3, 1},
+        {10e-3, 0},
+        {10e-3, 0},
+        {10e-3, 0},
+        {10e-3, 2},
+        {10e-3, 2},
+        {10e-3, 2}
+    });
+
+    auto simulationResult = simulation.run();
+
+    ASSERT_EQ(simulationResult.recordedSpikes.size(), 2);
+    ASSERT_EQ(simulationResult.recordedSpikes[0].neuronId, 0);
+    ASSERT_EQ(simulationResult.recordedSpikes[1].neuronId, 2);
+    ASSERT_FLOAT_EQ(simulationResult.recordedSpikes[1].time, 10e-3);
+}
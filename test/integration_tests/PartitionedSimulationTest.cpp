@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <core/StaticInputSimulation.hpp>
+#include <TestUtil.hpp>
+#include <algorithm>
+#include <numeric>
+
+using namespace soft_npu;
+
+auto makePartitionedSimulationParams(SizeType numPartitions) {
+    auto params = getStimulatedP1000Params();
+
+    (*params)["simulation"]["untilTime"] = 2.0;
+    (*params)["simulation"]["numPartitions"] = numPartitions;
+    (*params)["populationGenerators"]["p1000"]["inhibitorySynapseWeight"] = 0.5;
+    (*params)["populationGenerators"]["p1000"]["excitatorySynapseInitialWeight"] = 0.2;
+
+    return params;
+}
+
+TEST(PartitionedSimulationTest, Deterministic) {
+    auto simulationResult0 = StaticInputSimulation(makePartitionedSimulationParams(3)).run();
+    auto simulationResult1 = StaticInputSimulation(makePartitionedSimulationParams(3)).run();
+
+    ASSERT_FALSE(simulationResult0.recordedSpikes.empty());
+    ASSERT_EQ(simulationResult0.recordedSpikes.size(), simulationResult1.recordedSpikes.size());
+
+    for (SizeType i = 0; i < simulationResult0.recordedSpikes.size(); ++i) {
+        ASSERT_EQ(simulationResult0.recordedSpikes[i].time, simulationResult1.recordedSpikes[i].time);
+        ASSERT_EQ(simulationResult0.recordedSpikes[i].neuronId, simulationResult1.recordedSpikes[i].neuronId);
+    }
+
+    ASSERT_EQ(simulationResult0.finalSynapseInfos.size(), simulationResult1.finalSynapseInfos.size());
+
+    for (SizeType i = 0; i < simulationResult0.finalSynapseInfos.size(); ++i) {
+        ASSERT_EQ(simulationResult0.finalSynapseInfos[i].weight, simulationResult1.finalSynapseInfos[i].weight);
+    }
+}
+
+void assertSameResult(const SimulationResult& referenceResult, const SimulationResult& simulationResult) {
+    ASSERT_FALSE(referenceResult.recordedSpikes.empty());
+    ASSERT_EQ(referenceResult.recordedSpikes.size(), simulationResult.recordedSpikes.size());
+
+    for (SizeType i = 0; i < referenceResult.recordedSpikes.size(); ++i) {
+        ASSERT_EQ(referenceResult.recordedSpikes[i].time, simulationResult.recordedSpikes[i].time);
+        ASSERT_EQ(referenceResult.recordedSpikes[i].neuronId, simulationResult.recordedSpikes[i].neuronId);
+    }
+
+    ASSERT_EQ(referenceResult.finalSynapseInfos.size(), simulationResult.finalSynapseInfos.size());
+
+    for (SizeType i = 0; i < referenceResult.finalSynapseInfos.size(); ++i) {
+        const auto& referenceSynapseInfo = referenceResult.finalSynapseInfos[i];
+        const auto& synapseInfo = simulationResult.finalSynapseInfos[i];
+
+        ASSERT_EQ(referenceSynapseInfo.preSynapticNeuronId, synapseInfo.preSynapticNeuronId);
+        ASSERT_EQ(referenceSynapseInfo.postSynapticNeuronId, synapseInfo.postSynapticNeuronId);
+        ASSERT_EQ(referenceSynapseInfo.weight, synapseInfo.weight);
+        ASSERT_EQ(referenceSynapseInfo.isInhibitory, synapseInfo.isInhibitory);
+    }
+
+    ASSERT_EQ(referenceResult.neuronInfos.size(), simulationResult.neuronInfos.size());
+    ASSERT_EQ(referenceResult.numExcitatorySpikes, simulationResult.numExcitatorySpikes);
+    ASSERT_EQ(referenceResult.numInhibitorySpikes, simulationResult.numInhibitorySpikes);
+    ASSERT_EQ(referenceResult.numEventsProcessed, simulationResult.numEventsProcessed);
+}
+
+// runs with plasticity, input spikes and rewards, recording the output channels of all excitatory neurons
+auto runWithInputs(std::shared_ptr<ParamsType> params) {
+    StaticInputSimulation simulation(params);
+
+    std::deque<ChannelSpikeInfo> spikeTrains;
+    std::deque<RewardDoseInfo> rewardDoses;
+
+    for (SizeType i = 0; i < 200; ++i) {
+        spikeTrains.emplace_back(i * 7e-3, (i * 37) % 800);
+    }
+
+    for (SizeType i = 1; i < 8; ++i) {
+        rewardDoses.emplace_back(i * 0.23, 0.5);
+    }
+
+    for (SizeType channelId = 0; channelId < 800; ++channelId) {
+        simulation.recordOutputChannel(channelId);
+    }
+
+    simulation.setSpikeTrains(std::move(spikeTrains));
+    simulation.setRewardDoses(std::move(rewardDoses));
+
+    auto simulationResult = simulation.run();
+    return std::make_pair(std::move(simulationResult), simulation.getRecordedOutputChannelSpikes());
+}
+
+TEST(PartitionedSimulationTest, IdenticalToSingleProcess) {
+    auto [referenceResult, referenceOutputChannelSpikes] = runWithInputs(makePartitionedSimulationParams(1));
+
+    ASSERT_TRUE(std::any_of(
+            referenceResult.finalSynapseInfos.cbegin(),
+            referenceResult.finalSynapseInfos.cend(),
+            [](const SynapseInfo& synapseInfo) {
+        return !synapseInfo.isInhibitory && synapseInfo.weight != 0.2;
+    }));
+
+    for (SizeType numPartitions : {3, 4}) {
+        auto [simulationResult, outputChannelSpikes] = runWithInputs(makePartitionedSimulationParams(numPartitions));
+
+        assertSameResult(referenceResult, simulationResult);
+
+        ASSERT_FALSE(referenceOutputChannelSpikes.empty());
+        ASSERT_EQ(referenceOutputChannelSpikes.size(), outputChannelSpikes.size());
+
+        for (SizeType i = 0; i < referenceOutputChannelSpikes.size(); ++i) {
+            ASSERT_EQ(referenceOutputChannelSpikes[i].time, outputChannelSpikes[i].time);
+            ASSERT_EQ(referenceOutputChannelSpikes[i].channelId, outputChannelSpikes[i].channelId);
+        }
+    }
+}
+
+TEST(PartitionedSimulationTest, IdenticalToSingleProcessWithR2DSheet) {
+    auto makeR2DSheetParams = [](SizeType numPartitions) {
+        auto params = makePartitionedSimulationParams(numPartitions);
+        (*params)["simulation"]["populationGenerator"] = "r2dSheet";
+        (*params)["populationGenerators"]["r2dSheet"]["numNeurons"] = 2000;
+        (*params)["populationGenerators"]["r2dSheet"]["excitatorySynapseInitialWeight"] = 0.3;
+        return params;
+    };
+
+    auto [referenceResult, referenceOutputChannelSpikes] = runWithInputs(makeR2DSheetParams(1));
+
+    ASSERT_TRUE(std::any_of(
+            referenceResult.finalSynapseInfos.cbegin(),
+            referenceResult.finalSynapseInfos.cend(),
+            [](const SynapseInfo& synapseInfo) {
+        return !synapseInfo.isInhibitory && synapseInfo.weight != 0.3;
+    }));
+
+    auto [simulationResult, outputChannelSpikes] = runWithInputs(makeR2DSheetParams(3));
+
+    assertSameResult(referenceResult, simulationResult);
+
+    ASSERT_FALSE(referenceOutputChannelSpikes.empty());
+    ASSERT_EQ(referenceOutputChannelSpikes.size(), outputChannelSpikes.size());
+
+    for (SizeType i = 0; i < referenceOutputChannelSpikes.size(); ++i) {
+        ASSERT_EQ(referenceOutputChannelSpikes[i].time, outputChannelSpikes[i].time);
+        ASSERT_EQ(referenceOutputChannelSpikes[i].channelId, outputChannelSpikes[i].channelId);
+    }
+}
+
+TEST(PartitionedSimulationTest, IdenticalToSingleProcessInInferenceMode) {
+    auto referenceParams = makePartitionedSimulationParams(1);
+    auto params = makePartitionedSimulationParams(4);
+    (*referenceParams)["simulation"]["inferenceMode"] = true;
+    (*params)["simulation"]["inferenceMode"] = true;
+
+    assertSameResult(StaticInputSimulation(referenceParams).run(), StaticInputSimulation(params).run());
+}
+
+TEST(PartitionedSimulationTest, IdenticalToSingleProcessWithPrecomputedSchedule) {
+    auto referenceParams = makePartitionedSimulationParams(1);
+    auto params = makePartitionedSimulationParams(2);
+    (*referenceParams)["nonCoherentStimulator"]["precomputeSchedule"] = true;
+    (*params)["nonCoherentStimulator"]["precomputeSchedule"] = true;
+
+    assertSameResult(StaticInputSimulation(referenceParams).run(), StaticInputSimulation(params).run());
+}
+
+TEST(PartitionedSimulationTest, NeuronOrderingNotSupported) {
+    auto params = makePartitionedSimulationParams(2);
+    (*params)["simulation"]["neuronOrdering"] = "hilbert";
+
+    ASSERT_THROW(StaticInputSimulation simulation(params), std::runtime_error);
+}
+
+TEST(PartitionedSimulationTest, NegativeRewardNotSupported) {
+    StaticInputSimulation simulation(makePartitionedSimulationParams(2));
+    simulation.setRewardDoses({{0.1, -1.0}});
+
+    ASSERT_THROW(simulation.run(), std::runtime_error);
+}
+
+TEST(PartitionedSimulationTest, MergesEventLoadStats) {
+    auto referenceResult = StaticInputSimulation(makePartitionedSimulationParams(1)).run();
+    auto simulationResult = StaticInputSimulation(makePartitionedSimulationParams(3)).run();
+
+    for (SizeType queue = 0; queue < static_cast<SizeType>(EventQueue::numQueues); ++queue) {
+        const auto& referenceStats = referenceResult.eventLoadStats.getQueueLoadStats(static_cast<EventQueue>(queue));
+        const auto& stats = simulationResult.eventLoadStats.getQueueLoadStats(static_cast<EventQueue>(queue));
+
+        // every partition records each queue once per cycle, on a part of the population
+        const auto& referenceHistogram = referenceStats.getHistogram();
+        const auto& histogram = stats.getHistogram();
+
+        ASSERT_EQ(
+                3 * std::accumulate(referenceHistogram.cbegin(), referenceHistogram.cend(), static_cast<SizeType>(0)),
+                std::accumulate(histogram.cbegin(), histogram.cend(), static_cast<SizeType>(0)));
+        ASSERT_LE(stats.getHighWaterMark(), referenceStats.getHighWaterMark());
+    }
+
+    ASSERT_GT(simulationResult.eventLoadStats.getQueueLoadStats(EventQueue::transmissionEventsPerSlot).getHighWaterMark(), 0);
+    ASSERT_GT(simulationResult.wallTimeEventProcessor, 0);
+    ASSERT_LT(simulationResult.wallTimeEventProcessor, simulationResult.wallTimeTotal);
+}
@@ -0,0 +1,14 @@
+#include "PrecisionReference.hpp"
+#include <core/StaticInputSimulation.hpp>
+#include <type_traits>
+
+namespace precision_reference {
+
+static_assert(std::is_same_v<soft_npu::ValueType, double>);
+
+FiringStatistics runDoubleReference(const nlohmann::json& params) {
+    soft_npu::StaticInputSimulation simulation(std::make_shared<soft_npu::ParamsType>(params));
+    return getFiringStatistics(simulation.run());
+}
+
+}
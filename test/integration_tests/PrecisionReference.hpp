@@ -0,0 +1,35 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+namespace precision_reference {
+
+struct FiringStatistics {
+    double meanExcitatoryFiringRate;
+    double meanInhibitoryFiringRate;
+    double meanExcitatoryWeight;
+};
+
+template<typename SimulationResultType>
+FiringStatistics getFiringStatistics(const SimulationResultType& simulationResult) {
+    double excitatoryWeightSum = 0;
+    std::size_t numExcitatorySynapses = 0;
+
+    for (const auto& synapseInfo : simulationResult.finalSynapseInfos) {
+        if (!synapseInfo.isInhibitory) {
+            excitatoryWeightSum += synapseInfo.weight;
+            ++ numExcitatorySynapses;
+        }
+    }
+
+    return {
+        simulationResult.meanExcitatoryFiringRate,
+        simulationResult.meanInhibitoryFiringRate,
+        excitatoryWeightSum / numExcitatorySynapses};
+}
+
+// Runs a static input simulation with the double-precision engine. In a SOFT_NPU_SINGLE_PRECISION build, this is
+// the soft_npu_double_reference library, a double-precision build of the engine in its own namespace.
+FiringStatistics runDoubleReference(const nlohmann::json& params);
+
+}
@@ -0,0 +1,34 @@
+#include <gtest/gtest.h>
+#include <core/StaticInputSimulation.hpp>
+#include <TestUtil.hpp>
+#include "PrecisionReference.hpp"
+
+using namespace soft_npu;
+using namespace precision_reference;
+
+auto makePrecisionValidationParams() {
+    auto params = getStimulatedP1000Params();
+
+    (*params)["simulation"]["untilTime"] = 5.0;
+    (*params)["populationGenerators"]["p1000"]["inhibitorySynapseWeight"] = 0.5;
+    (*params)["populationGenerators"]["p1000"]["excitatorySynapseInitialWeight"] = 0.2;
+
+    return params;
+}
+
+// The reference statistics are computed by the double-precision engine on the same params. A single-precision build
+// (SOFT_NPU_SINGLE_PRECISION) must reproduce them within the tolerances below.
+TEST(PrecisionValidationTest, FiringStatisticsMatchDoubleReference) {
+    auto params = makePrecisionValidationParams();
+    auto reference = runDoubleReference(*params);
+
+    StaticInputSimulation simulation(params);
+    auto statistics = getFiringStatistics(simulation.run());
+
+    ASSERT_GT(reference.meanExcitatoryFiringRate, 0);
+    ASSERT_GT(reference.meanInhibitoryFiringRate, 0);
+
+    ASSERT_NEAR(statistics.meanExcitatoryFiringRate, reference.meanExcitatoryFiringRate, 0.02 * reference.meanExcitatoryFiringRate);
+    ASSERT_NEAR(statistics.meanInhibitoryFiringRate, reference.meanInhibitoryFiringRate, 0.02 * reference.meanInhibitoryFiringRate);
+    ASSERT_NEAR(statistics.meanExcitatoryWeight, reference.meanExcitatoryWeight, 0.01 * reference.meanExcitatoryWeight);
+}
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+#include <core/StaticInputSimulation.hpp>
+#include <core/QuantizedInferenceEngine.hpp>
+#include <genesis/PopulationGeneratorP1000.hpp>
+#include <neuro/Synapse.hpp>
+#include <TestUtil.hpp>
+#include <cmath>
+
+using namespace soft_npu;
+
+auto makeInferenceParams(SizeType weightBits) {
+    auto params = getStimulatedP1000Params();
+
+    (*params)["simulation"]["untilTime"] = 2.0;
+    (*params)["simulation"]["inferenceMode"] = true;
+    (*params)["populationGenerators"]["p1000"]["inhibitorySynapseWeight"] = 0.5;
+    (*params)["populationGenerators"]["p1000"]["excitatorySynapseInitialWeight"] = 0.2;
+
+    if (weightBits > 0) {
+        (*params)["quantizedInference"]["weightBits"] = weightBits;
+    }
+
+    return params;
+}
+
+// input spikes on the sensory channels, recording the output channels of all excitatory neurons
+auto runWithInputs(std::shared_ptr<ParamsType> params) {
+    StaticInputSimulation simulation(params);
+
+    std::deque<ChannelSpikeInfo> spikeTrains;
+
+    for (SizeType i = 0; i < 200; ++i) {
+        spikeTrains.emplace_back(i * 7e-3, (i * 37) % 800);
+    }
+
+    for (SizeType channelId = 0; channelId < 800; ++channelId) {
+        simulation.recordOutputChannel(channelId);
+    }
+
+    simulation.setSpikeTrains(std::move(spikeTrains));
+
+    auto simulationResult = simulation.run();
+    return std::make_pair(std::move(simulationResult), simulation.getRecordedOutputChannelSpikes());
+}
+
+TEST(QuantizedInferenceTest, Deterministic) {
+    auto [simulationResult0, outputChannelSpikes0] = runWithInputs(makeInferenceParams(8));
+    auto [simulationResult1, outputChannelSpikes1] = runWithInputs(makeInferenceParams(8));
+
+    ASSERT_FALSE(simulationResult0.recordedSpikes.empty());
+    ASSERT_EQ(simulationResult0.recordedSpikes.size(), simulationResult1.recordedSpikes.size());
+
+    for (SizeType i = 0; i < simulationResult0.recordedSpikes.size(); ++i) {
+        ASSERT_EQ(simulationResult0.recordedSpikes[i].time, simulationResult1.recordedSpikes[i].time);
+        ASSERT_EQ(simulationResult0.recordedSpikes[i].neuronId, simulationResult1.recordedSpikes[i].neuronId);
+    }
+
+    ASSERT_EQ(outputChannelSpikes0.size(), outputChannelSpikes1.size());
+    ASSERT_EQ(simulationResult0.numEventsProcessed, simulationResult1.numEventsProcessed);
+}
+
+// the spike and output channel counts stay close to those of the double engine
+TEST(QuantizedInferenceTest, CloseToDoubleEngine) {
+    auto [referenceResult, referenceOutputChannelSpikes] = runWithInputs(makeInferenceParams(0));
+
+    ASSERT_GT(referenceResult.numExcitatorySpikes, 0);
+    ASSERT_GT(referenceResult.numInhibitorySpikes, 0);
+    ASSERT_FALSE(referenceOutputChannelSpikes.empty());
+
+    for (SizeType weightBits : {16, 8}) {
+        auto [simulationResult, outputChannelSpikes] = runWithInputs(makeInferenceParams(weightBits));
+
+        auto tolerance = weightBits == 16 ? 1e-3 : 1e-2;
+
+        ASSERT_NEAR(simulationResult.numExcitatorySpikes, referenceResult.numExcitatorySpikes, tolerance * referenceResult.numExcitatorySpikes);
+        ASSERT_NEAR(simulationResult.numInhibitorySpikes, referenceResult.numInhibitorySpikes, tolerance * referenceResult.numInhibitorySpikes);
+        ASSERT_NEAR(outputChannelSpikes.size(), referenceOutputChannelSpikes.size(), tolerance * referenceOutputChannelSpikes.size());
+
+        // the weights are not changed by the quantized engine
+        ASSERT_EQ(referenceResult.finalSynapseInfos.size(), simulationResult.finalSynapseInfos.size());
+
+        for (SizeType i = 0; i < referenceResult.finalSynapseInfos.size(); ++i) {
+            ASSERT_EQ(referenceResult.finalSynapseInfos[i].weight, simulationResult.finalSynapseInfos[i].weight);
+        }
+    }
+}
+
+// pEvo circuits with continuous inhibition
+TEST(QuantizedInferenceTest, ContinuousInhibition) {
+    auto makeParams = [](SizeType weightBits) {
+        auto params = makeInferenceParams(weightBits);
+        (*params)["simulation"]["populationGenerator"] = "pEvo";
+        (*params)["populationGenerators"]["pEvo"] = R"(
+{
+    "channelProjectedEpsp": 1.5,
+    "inChannelDivergence": 10,
+    "outChannelConvergence": 20,
+    "minConductionDelay": 1e-3,
+    "maxConductionDelay": 20e-3,
+    "minInitialWeight": 0.1,
+    "maxInitialWeight": 0.2,
+    "intraCircuitConnectDensity": 1,
+    "interCircuitConnectDensity": 1
+}
+)"_json;
+        (*params)["neuronParams"]["autoInhibition"] = (*params)["neuronParams"]["continuousInhibitionSource"];
+        (*params)["neuronParams"]["autoInhibition"]["epspOverrideScaleFactor"] = 0.1;
+        (*params)["neuronParams"]["crossInhibition"] = (*params)["neuronParams"]["continuousInhibitionSource"];
+        (*params)["neuronParams"]["crossInhibition"]["epspOverrideScaleFactor"] = 0.2;
+        (*params)["nonCoherentStimulator"]["rate"] = 20.0;
+        return params;
+    };
+
+    auto referenceResult = StaticInputSimulation(makeParams(0)).run();
+    ASSERT_GT(referenceResult.numExcitatorySpikes, 0);
+    ASSERT_GT(referenceResult.numInhibitorySpikes, 0);
+
+    auto simulationResult = StaticInputSimulation(makeParams(16)).run();
+
+    ASSERT_NEAR(simulationResult.numExcitatorySpikes, referenceResult.numExcitatorySpikes, 0.02 * referenceResult.numExcitatorySpikes);
+    // only about a dozen inhibitory spikes, so a relative tolerance would demand an exact match
+    ASSERT_NEAR(simulationResult.numInhibitorySpikes, referenceResult.numInhibitorySpikes, 3);
+}
+
+TEST(QuantizedInferenceTest, WeightsWithinHalfStep) {
+    auto params = makeInferenceParams(0);
+    RandomEngineType randomEngine(0);
+    auto population = PopulationGeneratorP1000(*params, randomEngine).generatePopulation();
+
+    SizeType numSynapses = 0;
+
+    for (auto neuronIt = population->cbeginNeurons(); neuronIt != population->cendNeurons(); ++neuronIt) {
+        numSynapses += (*neuronIt)->cendOutboundSynapses() - (*neuronIt)->cbeginOutboundSynapses();
+    }
+
+    for (SizeType weightBits : {16, 8}) {
+        QuantizedInferenceEngine engine(*population, 1e-4, weightBits);
+
+        ASSERT_NEAR(engine.getWeightScale() * ((1 << (weightBits - 1)) - 1), 0.5, 1e-12);
+
+        for (auto neuronIt = population->cbeginNeurons(); neuronIt != population->cendNeurons(); ++neuronIt) {
+            const auto& neuron = **neuronIt;
+            auto signum = neuron.getNeuronParams()->isInhibitory ? -1 : 1;
+
+            for (auto synIt = neuron.cbeginOutboundSynapses(); synIt != neuron.cendOutboundSynapses(); ++synIt) {
+                auto weight = engine.getWeight(neuron.getNeuronId(), synIt - neuron.cbeginOutboundSynapses());
+                ASSERT_NEAR(weight, signum * (*synIt)->weight, engine.getWeightScale() / 2);
+            }
+        }
+    }
+
+    // one byte per synapse less with 8 bits
+    ASSERT_EQ(
+            QuantizedInferenceEngine(*population, 1e-4, 16).getNumStorageBytes() -
+            QuantizedInferenceEngine(*population, 1e-4, 8).getNumStorageBytes(),
+            numSynapses);
+}
+
+// the trained weights replace the generated ones
+TEST(QuantizedInferenceTest, LoadTrainedWeights) {
+    auto trainingParams = makeInferenceParams(0);
+    (*trainingParams)["simulation"]["inferenceMode"] = false;
+    auto trainingResult = StaticInputSimulation(trainingParams).run();
+
+    ASSERT_TRUE(std::any_of(
+            trainingResult.finalSynapseInfos.cbegin(),
+            trainingResult.finalSynapseInfos.cend(),
+            [](const SynapseInfo& synapseInfo) {
+        return !synapseInfo.isInhibitory && synapseInfo.weight != 0.2;
+    }));
+
+    StaticInputSimulation simulation(makeInferenceParams(8));
+    simulation.loadTrainedWeights(trainingResult.finalSynapseInfos);
+    auto simulationResult = simulation.run();
+
+    ASSERT_EQ(trainingResult.finalSynapseInfos.size(), simulationResult.finalSynapseInfos.size());
+
+    for (SizeType i = 0; i < trainingResult.finalSynapseInfos.size(); ++i) {
+        ASSERT_EQ(trainingResult.finalSynapseInfos[i].weight, simulationResult.finalSynapseInfos[i].weight);
+    }
+
+    auto mismatchingSynapseInfos = trainingResult.finalSynapseInfos;
+    mismatchingSynapseInfos.pop_back();
+
+    StaticInputSimulation mismatchingSimulation(makeInferenceParams(8));
+    mismatchingSimulation.loadTrainedWeights(mismatchingSynapseInfos);
+    ASSERT_THROW(mismatchingSimulation.run(), std::runtime_error);
+}
+
+TEST(QuantizedInferenceTest, RequiresInferenceMode) {
+    auto params = makeInferenceParams(8);
+    (*params)["simulation"]["inferenceMode"] = false;
+
+    ASSERT_THROW(StaticInputSimulation(params).run(), std::runtime_error);
+}
+
+TEST(QuantizedInferenceTest, InvalidWeightBits) {
+    ASSERT_THROW(StaticInputSimulation(makeInferenceParams(4)).run(), std::runtime_error);
+}
+
+TEST(QuantizedInferenceTest, VoltagesNotSupported) {
+    StaticInputSimulation recordingSimulation(makeInferenceParams(8));
+    recordingSimulation.recordVoltage(0, 0.5);
+    ASSERT_THROW(recordingSimulation.run(), std::runtime_error);
+
+    StaticInputSimulation probingSimulation(makeInferenceParams(8));
+    probingSimulation.probeVoltages({0}, 1e-3);
+    ASSERT_THROW(probingSimulation.run(), std::runtime_error);
+}
+
+TEST(QuantizedInferenceTest, PartitionsNotSupported) {
+    auto params = makeInferenceParams(8);
+    (*params)["simulation"]["numPartitions"] = 2;
+
+    ASSERT_THROW(StaticInputSimulation simulation(params), std::runtime_error);
+}
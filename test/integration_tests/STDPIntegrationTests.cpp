@@ -256,7 +256,7 @@ TEST(STDPIntegrationTests, PotentiationTwoEPSPOneWouldBeEnough) {
 
     ASSERT_EQ(simulationResult.numExcitatorySpikes, 3);
     ASSERT_EQ(simulationResult.numInhibitorySpikes, 0);
-    ASSERT_EQ(simulationResult.numEventsProcessed, 8);
+    ASSERT_EQ(simulationResult.numEventsProcessed, 7);
 
     auto finalSynapseInfos = simulationResult.finalSynapseInfos;
     std::sort(finalSynapseInfos.begin(), finalSynapseInfos.end());
@@ -649,7 +649,7 @@ TEST(STDPIntegrationTests, STDPComplexScenario) {
 
     ASSERT_EQ(simulationResult.numExcitatorySpikes, 6);
     ASSERT_EQ(simulationResult.numInhibitorySpikes, 2);
-    ASSERT_EQ(simulationResult.numEventsProcessed, 22);
+    ASSERT_EQ(simulationResult.numEventsProcessed, 21);
 
     auto finalSynapseInfos = simulationResult.finalSynapseInfos;
     std::sort(finalSynapseInfos.begin(), finalSynapseInfos.end());